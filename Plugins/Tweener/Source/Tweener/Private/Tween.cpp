@@ -1,6 +1,12 @@
 #include "Tween.h"
 
 #include "TweenerSubsystem.h"
+#include "TweenPreset.h"
+#include "TweenInstanceBatch.h"
+#include "TweenSignificance.h"
+#include "TweenerStats.h"
+#include "TweenerTrace.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "AHEasing/easing.h"
 #include "Blueprint/UserWidget.h"
@@ -10,11 +16,40 @@
 #include "Components/CanvasPanelSlot.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
-#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
 #include "Runtime/Launch/Resources/Version.h"
 
 using namespace AHEasing;
 
+const FName TweenTimeDomain::Gameplay(TEXT("Gameplay"));
+const FName TweenTimeDomain::UI(TEXT("UI"));
+const FName TweenTimeDomain::Cinematic(TEXT("Cinematic"));
+
+namespace
+{
+	int32 GTweenerStripCosmeticTweens = 1;
+	FAutoConsoleVariableRef CVarTweenerStripCosmeticTweens(
+		TEXT("tweener.StripCosmeticTweens"),
+		GTweenerStripCosmeticTweens,
+		TEXT("Cosmetic tweens complete as soon as they start on dedicated servers and when rendering is disabled."),
+		ECVF_Default);
+
+	/** The batch of the component's world, whose subsystem commits it after ticking the tweens */
+	FTweenInstanceBatch* FindInstanceBatch(const UInstancedStaticMeshComponent& Component)
+	{
+		const UWorld* World = Component.GetWorld();
+		UTweenerSubsystem* Subsystem = World ? World->GetSubsystem<UTweenerSubsystem>() : nullptr;
+
+		return Subsystem ? &Subsystem->GetInstanceBatch() : nullptr;
+	}
+}
+
+// the state read on every update, StartValue to Priority, has to fit in 128 bytes
+static_assert(STRUCT_OFFSET(UTween, Priority) + sizeof(ETweenPriority) - STRUCT_OFFSET(UTween, StartValue) <= 128,
+	"UTween's hot state has grown past 128 bytes, move anything that isn't read on every update after Priority");
+
 float EaseElasticPunch(const float Value)
 {
 	if (FMath::IsNearlyEqual(Value, 0))
@@ -100,12 +135,27 @@ float EaseHelper(const float Value, const  EEaseType Type)
 	}
 }
 
+float UTween::Ease(const float Alpha) const
+{
+	if (EaseType == EEaseType::CubicBezier && CubicBezierCurve.IsValid())
+	{
+		return CubicBezierCurve->Evaluate(Alpha);
+	}
+
+	return EaseHelper(Alpha, EaseType);
+}
+
 UTween* UTween::NewTween(FWeakObjectPtr ObjectPtr, ETweenTargetObjectType TweenTargetObject, ETweenType TweenType, FVector4 Target, bool bIsRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
 {
+	LLM_SCOPE_BYTAG(Tweener);
+
 	UObject* Outer = WorldContextObject ? WorldContextObject->GetWorld() : (UObject*)GetTransientPackage();
 	
 	UTween* Tween = NewObject<UTween>(Outer);
 
+	INC_DWORD_STAT(STAT_TweenerAllocations);
+	CSV_CUSTOM_STAT(Tweener, Allocations, 1, ECsvCustomStatOp::Accumulate);
+
 	Tween->ObjectPtr = ObjectPtr;
 	Tween->Duration = Duration;
 	Tween->bIsRelativeTween = bIsRelative;
@@ -118,6 +168,7 @@ UTween* UTween::NewTween(FWeakObjectPtr ObjectPtr, ETweenTargetObjectType TweenT
 	Tween->TweenType = TweenType;
 	Tween->TargetObjectType = TweenTargetObject;
 	Tween->WorldContextObject = WorldContextObject;
+	Tween->bIsSignificanceThrottled = FTweenSignificance::IsThrottledByDefault();
 	
 	return Tween;
 }
@@ -147,6 +198,19 @@ UTween* UTween::NewTweenSceneComponentFrom(USceneComponent* SceneComponent, ETwe
 		Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
 }
 
+UTween* UTween::NewTweenInstancedStaticMesh(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, ETweenType TweenType, FVector4 Target, bool bIsRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	if (!InstancedStaticMesh || !InstancedStaticMesh->IsValidInstance(InstanceIndex))
+	{
+		return nullptr;
+	}
+
+	UTween* Tween = NewTween(FWeakObjectPtr(InstancedStaticMesh), ETweenTargetObjectType::InstancedStaticMesh, TweenType, Target, bIsRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+
+	Tween->ParameterIndex = InstanceIndex;
+
+	return Tween;
+}
 
 UTween* UTween::NewTweenWidget(UWidget* Widget, ETweenType TweenType, FVector4 Target, bool bIsRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
 {
@@ -425,6 +489,99 @@ UTween* UTween::ActorRelativeRotationFrom(AActor* Actor, FQuat Rotation,
 		Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
 }
 
+UTween* UTween::InstanceLocationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Location,
+	bool bIsLocationRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops,
+	float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return NewTweenInstancedStaticMesh(InstancedStaticMesh, InstanceIndex, ETweenType::Location, FVector4(Location), bIsLocationRelative,
+		Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+}
+
+UTween* UTween::InstanceRelativeLocationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Location,
+	bool bIsLocationRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops,
+	float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return NewTweenInstancedStaticMesh(InstancedStaticMesh, InstanceIndex, ETweenType::RelativeLocation, FVector4(Location), bIsLocationRelative,
+		Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+}
+
+UTween* UTween::InstanceRotationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FQuat Rotation,
+	bool bIsRotationRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops,
+	float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return NewTweenInstancedStaticMesh(InstancedStaticMesh, InstanceIndex, ETweenType::Rotation, FVector4(Rotation.X, Rotation.Y, Rotation.Z, Rotation.W), bIsRotationRelative,
+		Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+}
+
+UTween* UTween::InstanceRelativeRotationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FQuat Rotation,
+	bool bIsRotationRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops,
+	float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return NewTweenInstancedStaticMesh(InstancedStaticMesh, InstanceIndex, ETweenType::RelativeRotation, FVector4(Rotation.X, Rotation.Y, Rotation.Z, Rotation.W), bIsRotationRelative,
+		Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+}
+
+UTween* UTween::InstanceScaleTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Scale,
+	bool bIsScaleRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops,
+	float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return NewTweenInstancedStaticMesh(InstancedStaticMesh, InstanceIndex, ETweenType::Scale, FVector4(Scale), bIsScaleRelative,
+		Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+}
+
+UTween* UTween::InstanceRelativeScaleTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Scale,
+	bool bIsScaleRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops,
+	float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return NewTweenInstancedStaticMesh(InstancedStaticMesh, InstanceIndex, ETweenType::RelativeScale, FVector4(Scale), bIsScaleRelative,
+		Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+}
+
+UTween* UTween::ComponentPresetTo(USceneComponent* SceneComponent, const UTweenPreset* Preset, FTransform Target, const UObject* WorldContextObject)
+{
+	if (!Preset)
+	{
+		return nullptr;
+	}
+
+	UTween* Tween = NewTweenSceneComponent(SceneComponent, Preset->TweenType, Preset->GetTargetValue(Target), Preset->bIsRelative,
+		Preset->Duration, Preset->EaseType, Preset->LoopType, Preset->Loops, Preset->DelayBetweenLoops, WorldContextObject);
+
+	if (Tween)
+	{
+		Tween->ApplyPreset(*Preset);
+	}
+
+	return Tween;
+}
+
+UTween* UTween::InstancePresetTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, const UTweenPreset* Preset, FTransform Target,
+	const UObject* WorldContextObject)
+{
+	if (!Preset)
+	{
+		return nullptr;
+	}
+
+	UTween* Tween = NewTweenInstancedStaticMesh(InstancedStaticMesh, InstanceIndex, Preset->TweenType, Preset->GetTargetValue(Target), Preset->bIsRelative,
+		Preset->Duration, Preset->EaseType, Preset->LoopType, Preset->Loops, Preset->DelayBetweenLoops, WorldContextObject);
+
+	if (Tween)
+	{
+		Tween->ApplyPreset(*Preset);
+	}
+
+	return Tween;
+}
+
+void UTween::ApplyPreset(const UTweenPreset& InPreset)
+{
+	// Duration, loops and delays are copied as they are the tween's running state, the curve is shared as is
+	Preset = &InPreset;
+	Delay = InPreset.Delay;
+	CubicBezierCurve = InPreset.GetCubicBezierCurve();
+}
+
 UTween* UTween::WidgetSlotPositionTo(UWidget* Widget, FVector2D Location, bool bIsLocationRelative, float Duration,
 	EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
 {
@@ -706,7 +863,7 @@ UTween* UTween::CustomAction(UObject* Object, float From, float To, float Durati
 	UTween* Tween = NewTween(FWeakObjectPtr(Object), ETweenTargetObjectType::CustomAction, ETweenType::Scalar, FVector4(To),false,
 		Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
 
-	Tween->StartValue = FVector4(From);
+	Tween->SetStartValue(FVector4(From));
 	
 	return Tween;
 }
@@ -718,7 +875,7 @@ UTween* UTween::NextVectorTo(FVector VectorTo, float InDuration, float InDelay)
 	NextTween = NewTween(ObjectPtr, this->TargetObjectType, TweenType, VectorTo, bIsRelativeTween, 
 		InDuration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
 
-	NextTween->ParameterName = ParameterName;
+	CopyChainSettingsTo(NextTween);
 	NextTween->Delay = InDelay;
 
 	return NextTween;
@@ -731,7 +888,7 @@ UTween* UTween::NextRotationTo(FQuat RotationTo, float InDuration, float InDelay
 	NextTween = NewTween(ObjectPtr, this->TargetObjectType, TweenType,FVector4(RotationTo.X, RotationTo.Y, RotationTo.Z, RotationTo.W), bIsRelativeTween, 
 		InDuration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
 
-	NextTween->ParameterName = ParameterName;
+	CopyChainSettingsTo(NextTween);
 	NextTween->Delay = InDelay;
 
 	return NextTween;
@@ -743,7 +900,7 @@ UTween* UTween::NextColorTo(FLinearColor ColorTo, float InDuration, float InDela
 	NextTween = NewTween(ObjectPtr, this->TargetObjectType, TweenType, ColorTo, bIsRelativeTween, 
 		InDuration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
 
-	NextTween->ParameterName = ParameterName;
+	CopyChainSettingsTo(NextTween);
 	NextTween->Delay = InDelay;
 
 	return NextTween;
@@ -754,7 +911,7 @@ UTween* UTween::NextScalarTo(float ScalarTo, float InDuration, float InDelay)
 	NextTween = NewTween(ObjectPtr, this->TargetObjectType, TweenType, FVector4(ScalarTo), bIsRelativeTween, 
 		InDuration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
 
-	NextTween->ParameterName = ParameterName;
+	CopyChainSettingsTo(NextTween);
 	NextTween->Delay = InDelay;
 
 	return NextTween;
@@ -773,6 +930,21 @@ UTween* UTween::NextScalarTo(float ScalarTo, float InDuration, float InDelay)
 //}
 
 bool UTween::CacheInitialValues()
+{
+	// custom actions start from the value they were given
+	FVector4 InitialValue = GetStartValue();
+
+	if (!GetInitialValue(InitialValue))
+	{
+		return false;
+	}
+
+	SetStartValue(InitialValue);
+
+	return true;
+}
+
+bool UTween::GetInitialValue(FVector4& OutValue)
 {
 	UObject* Object = ObjectPtr.Get();
 
@@ -786,26 +958,33 @@ bool UTween::CacheInitialValues()
 		case ETweenTargetObjectType::SceneComponent:
 			if (const USceneComponent * SceneComponent = Cast<USceneComponent>(Object))
 			{
-				return GetValueSceneComponent(StartValue, *SceneComponent, TweenType);
+				return GetValueSceneComponent(OutValue, *SceneComponent, TweenType);
 			}
 			break;
 			
+		case ETweenTargetObjectType::InstancedStaticMesh:
+			if (UInstancedStaticMeshComponent* InstancedStaticMesh = Cast<UInstancedStaticMeshComponent>(Object))
+			{
+				return GetValueInstancedStaticMesh(OutValue, *InstancedStaticMesh, TweenType, ParameterIndex);
+			}
+			break;
+
 		case ETweenTargetObjectType::Material:
 			if (UMaterialInstanceDynamic* Material = Cast<UMaterialInstanceDynamic>(Object))
 			{
-				return GetValueMaterial(StartValue, ParameterIndex, *Material, ParameterName, TweenType);
+				return GetValueMaterial(OutValue, ParameterIndex, *Material, ParameterName, TweenType);
 			}
 			break;
 			
 		case ETweenTargetObjectType::Widget:
 			if (const UWidget* Widget = Cast<UWidget>(Object))
 			{
-				return GetValueWidget(StartValue,*Widget,TweenType);
+				return GetValueWidget(OutValue,*Widget,TweenType);
 			}
 			break;
 
 		case ETweenTargetObjectType::Property:
-			return GetValueProperty(StartValue,CachedProperty,*Object,ParameterName,TweenType);
+			return GetValueProperty(OutValue,CachedProperty,*Object,ParameterName,TweenType);
 
 		case ETweenTargetObjectType::CustomAction:
 			return true;
@@ -817,6 +996,27 @@ bool UTween::CacheInitialValues()
 	return false;
 }
 
+bool UTween::CacheProperty()
+{
+	UObject* Object = ObjectPtr.Get();
+
+	FVector4 CurrentValue;
+	return Object && GetValueProperty(CurrentValue, CachedProperty, *Object, ParameterName, TweenType);
+}
+
+void UTween::CopyChainSettingsTo(UTween* Tween) const
+{
+	Tween->ParameterName = ParameterName;
+	Tween->CubicBezierCurve = CubicBezierCurve;
+	Tween->TickGroup = TickGroup;
+	Tween->TimeDomain = TimeDomain;
+	Tween->TimeScale = TimeScale;
+	Tween->Groups = Groups;
+	Tween->bIsSignificanceThrottled = bIsSignificanceThrottled;
+	Tween->Priority = Priority;
+	Tween->bIsCosmetic = bIsCosmetic;
+}
+
 bool UTween::PrepareForUse()
 {
 	if (!CacheInitialValues())
@@ -825,7 +1025,22 @@ bool UTween::PrepareForUse()
 	}
 		
 	ElapsedTime = -Delay;
+	FixedStepUnits = 0;
+	bIsSpringAsleep = false;
+	bIsPendingRemoval = false;
+
+	Significance = ETweenSignificance::Full;
+	SignificanceCheckCountdown = 0.f;
+	PendingDeltaTime = 0.f;
+	PendingUnscaledDeltaTime = 0.f;
 
+	CalculateEndValue();
+
+	return true;
+}
+
+void UTween::CalculateEndValue()
+{
 	switch (GetTargetValueType())
 	{
 		case ETargetValueType::Vector:
@@ -833,11 +1048,11 @@ bool UTween::PrepareForUse()
 		case ETargetValueType::Scalar:
 			if (bIsRelativeTween)
 			{
-				EndValue = StartValue + TargetValue;
+				EndValue = StartValue + FVector4f(TargetValue);
 			}
 			else
 			{
-				EndValue = TargetValue;
+				SetEndValue(TargetValue);
 			}
 			break;
 		
@@ -848,17 +1063,15 @@ bool UTween::PrepareForUse()
 				const FQuat Target = FQuat(TargetValue.X, TargetValue.Y, TargetValue.Z, TargetValue.W);
 				const FQuat End = Start * Target;
 
-				EndValue = FVector4(End.X, End.Y, End.Z, End.W);
+				SetEndValue(FVector4(End.X, End.Y, End.Z, End.W));
 			}
 			else
 			{
-				EndValue = TargetValue;
+				SetEndValue(TargetValue);
 			}
 
 			break;
 	}
-
-	return true;
 }
 
 
@@ -923,6 +1136,50 @@ bool UTween::GetValueSceneComponent(FVector4 &OutVec, const USceneComponent& Sce
 	}
 }
 
+bool UTween::GetValueInstancedStaticMesh(FVector4& OutVec, UInstancedStaticMeshComponent& InstancedStaticMesh, ETweenType TweenType, int32 InstanceIndex)
+{
+	FTransform Transform;
+
+	const FTweenInstanceBatch* Batch = FindInstanceBatch(InstancedStaticMesh);
+
+	if (Batch ? !Batch->GetInstanceTransform(InstancedStaticMesh, InstanceIndex, Transform) : !InstancedStaticMesh.GetInstanceTransform(InstanceIndex, Transform, false))
+	{
+		return false;
+	}
+
+	switch (TweenType)
+	{
+		case ETweenType::Location:
+		case ETweenType::Rotation:
+		case ETweenType::Scale:
+			Transform = Transform * InstancedStaticMesh.GetComponentTransform();
+			break;
+		default:
+			break;
+	}
+
+	switch (TweenType)
+	{
+		case ETweenType::Location:
+		case ETweenType::RelativeLocation:
+			OutVec = Transform.GetLocation();
+			return true;
+		case ETweenType::Rotation:
+		case ETweenType::RelativeRotation:
+			{
+				const FQuat Rotation = Transform.GetRotation();
+				OutVec = FVector4(Rotation.X, Rotation.Y, Rotation.Z, Rotation.W);
+				return true;
+			}
+		case ETweenType::Scale:
+		case ETweenType::RelativeScale:
+			OutVec = Transform.GetScale3D();
+			return true;
+		default:
+			return false;
+	}
+}
+
 bool UTween::GetValueMaterial(FVector4& OutVec,int32 &OutParameterIndex, UMaterialInstanceDynamic& Material, FName ParameterName, ETweenType TweenType)
 {
 	const FMaterialParameterInfo ParameterInfo(ParameterName);
@@ -1138,6 +1395,22 @@ float UTween::PercentComplete() const
 	return ModifiedElapsedTime / Duration;
 }
 
+float UTween::GetTotalDuration() const
+{
+	if (bIsSpring || LoopType == ELoopType::None)
+	{
+		return Delay + (bIsSpring ? 0.f : Duration);
+	}
+
+	// HandleLooping only stops once Loops counts down to exactly zero
+	if (Loops <= 0)
+	{
+		return TNumericLimits<float>::Max();
+	}
+
+	return Delay + Duration + Loops * (DelayBetweenLoops + Duration);
+}
+
 bool UTween::Tick(float DeltaTime, float UnscaledDeltaTime, bool bCompleteTweenThisStep)
 {
 	// fetch our deltaTime. It will either be taking this to completion or standard delta/unscaledDelta
@@ -1157,6 +1430,11 @@ bool UTween::Tick(float DeltaTime, float UnscaledDeltaTime, bool bCompleteTweenT
 		DeltaTime = bIsTimeScaleIndependent ? UnscaledDeltaTime : DeltaTime;
 	}
 
+	if (bIsSpring)
+	{
+		return TickSpring(DeltaTime, bCompleteTweenThisStep);
+	}
+
 	// add deltaTime to our elapsed time and clamp it from -delay to duration
 	ElapsedTime = FMath::Clamp(ElapsedTime + DeltaTime, -Delay, Duration);
 
@@ -1168,9 +1446,53 @@ bool UTween::Tick(float DeltaTime, float UnscaledDeltaTime, bool bCompleteTweenT
 
 	const float ModifiedElapsedTime = bIsRunningInReverse ? Duration - ElapsedTime : ElapsedTime;
 
-	const float EasedTime = EaseHelper(ModifiedElapsedTime / Duration, EaseType);//(animCurve == null) ? EaseHelper.ease(easeType, modifiedElapsedTime, duration) : animCurve.Evaluate(modifiedElapsedTime / duration);
+	return ApplyProgress(ModifiedElapsedTime / Duration, FMath::IsNearlyEqual(ElapsedTime, Duration));
+}
+
+bool UTween::TickFixedStep(int32 StepsPerSecond)
+{
+	const float StepSeconds = 1.f / StepsPerSecond;
+
+	// springs integrate step by step already
+	if (bIsSpring)
+	{
+		return Tick(StepSeconds * TimeScale, StepSeconds * TimeScale);
+	}
+
+	const int64 UnitsPerSecond = static_cast<int64>(StepsPerSecond) * FixedStepSubdivisions;
+
+	// rounded up to whole steps, less a little so a duration that is a whole number of steps isn't pushed over by its float error
+	const int64 DelayUnits = FMath::Max<int64>(FMath::CeilToInt64(static_cast<double>(Delay) * StepsPerSecond - KINDA_SMALL_NUMBER), 0) * FixedStepSubdivisions;
+	const int64 DurationUnits = FMath::Max<int64>(FMath::CeilToInt64(static_cast<double>(Duration) * StepsPerSecond - KINDA_SMALL_NUMBER), 1) * FixedStepSubdivisions;
+
+	// ReverseTween, SetDelay, a load or a rollback moved ElapsedTime
+	if (FixedStepUnits < 0)
+	{
+		FixedStepUnits = DelayUnits + FMath::RoundToInt64(static_cast<double>(ElapsedTime) * UnitsPerSecond);
+	}
+
+	FixedStepUnits = FMath::Clamp<int64>(FixedStepUnits + FMath::RoundToInt64(static_cast<double>(TimeScale) * FixedStepSubdivisions), 0, DelayUnits + DurationUnits);
+
+	const int64 ActiveUnits = FixedStepUnits - DelayUnits;
+	const bool bIsAtEnd = ActiveUnits == DurationUnits;
+
+	// kept for everything that reads the tween's time, nothing here accumulates it
+	ElapsedTime = bIsAtEnd ? Duration : static_cast<float>(static_cast<double>(ActiveUnits) / UnitsPerSecond);
+
+	if (ActiveUnits <= 0)
+	{
+		return false;
+	}
+
+	const int64 ModifiedUnits = bIsRunningInReverse ? DurationUnits - ActiveUnits : ActiveUnits;
+
+	return ApplyProgress(static_cast<float>(static_cast<double>(ModifiedUnits) / DurationUnits), bIsAtEnd);
+}
+
+bool UTween::ApplyProgress(float Alpha, bool bIsAtEnd)
+{
+	const float EasedTime = Ease(Alpha);
 
-	
 	FVector4 Vec;
 	
 	switch (GetTargetValueType())
@@ -1178,7 +1500,7 @@ bool UTween::Tick(float DeltaTime, float UnscaledDeltaTime, bool bCompleteTweenT
 	case ETargetValueType::Vector: 
 	case ETargetValueType::Color: 
 	case ETargetValueType::Scalar:
-		Vec = (StartValue * (1.0f-EasedTime)) + (EndValue * EasedTime);
+		Vec = FromStoredValue((StartValue * (1.0f-EasedTime)) + (EndValue * EasedTime));
 		break;
 	case ETargetValueType::Quat:
 		{
@@ -1194,6 +1516,7 @@ bool UTween::Tick(float DeltaTime, float UnscaledDeltaTime, bool bCompleteTweenT
 
 	if (Action.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_TweenerApplyCustomAction);
 		Action.Broadcast(ObjectPtr.Get(false), EasedTime,Vec.X );
 	}
 
@@ -1201,17 +1524,106 @@ bool UTween::Tick(float DeltaTime, float UnscaledDeltaTime, bool bCompleteTweenT
 	SetAsRequiredPerCurrentTweenType(Vec);
 
 	// if we have a loopType and we are done do the loop
-	if (LoopType != ELoopType::None && FMath::IsNearlyEqual(ElapsedTime, Duration))
+	if (LoopType != ELoopType::None && bIsAtEnd)
 	{
 		HandleLooping();
 	}
 
-	return FMath::IsNearlyEqual(ElapsedTime, Duration);
+	return bIsAtEnd;
+}
+
+/// <summary>
+/// critically damped spring step, see "Spring-It-On: The Game Developer's Spring-Roll-Call" (Holden).
+/// returns true once settled on the end value, which puts the spring to sleep
+/// </summary>
+bool UTween::TickSpring(float DeltaTime, bool bCompleteTweenThisStep)
+{
+	bool bIsSettled = bCompleteTweenThisStep;
+
+	if (!bCompleteTweenThisStep)
+	{
+		// consume any delay before the spring starts moving
+		if (ElapsedTime < 0)
+		{
+			ElapsedTime += DeltaTime;
+
+			if (ElapsedTime < 0)
+			{
+				return false;
+			}
+
+			DeltaTime = ElapsedTime;
+			ElapsedTime = 0.f;
+		}
+
+		constexpr float Ln2 = 0.69314718f;
+		constexpr float SettleTolerance = 1e-3f;
+
+		const float HalfDamping = (2.f * Ln2) / FMath::Max(SpringHalfLife, KINDA_SMALL_NUMBER);
+		const float Decay = FMath::Exp(-HalfDamping * DeltaTime);
+
+		if (GetTargetValueType() == ETargetValueType::Quat)
+		{
+			const FQuat Current = FQuat(StartValue.X, StartValue.Y, StartValue.Z, StartValue.W);
+			const FQuat Goal = FQuat(EndValue.X, EndValue.Y, EndValue.Z, EndValue.W);
+
+			FQuat Difference = Current * Goal.Inverse();
+			if (Difference.W < 0.f)
+			{
+				Difference = Difference * -1.f;
+			}
+
+			const FQuat LogDifference = Difference.Log();
+			const FVector J0 = FVector(LogDifference.X, LogDifference.Y, LogDifference.Z);
+			const FVector Velocity = FVector(SpringVelocity.X, SpringVelocity.Y, SpringVelocity.Z);
+			const FVector J1 = Velocity + J0 * HalfDamping;
+
+			const FVector Offset = Decay * (J0 + J1 * DeltaTime);
+			const FVector NewVelocity = Decay * (Velocity - J1 * HalfDamping * DeltaTime);
+
+			const FQuat Position = (FQuat(Offset.X, Offset.Y, Offset.Z, 0.f).Exp() * Goal).GetNormalized();
+
+			StartValue = ToStoredValue(FVector4(Position.X, Position.Y, Position.Z, Position.W));
+			SpringVelocity = FVector4f(FVector4(NewVelocity, 0.f));
+
+			bIsSettled = Offset.SizeSquared() < FMath::Square(SettleTolerance) && NewVelocity.SizeSquared() < FMath::Square(SettleTolerance);
+		}
+		else
+		{
+			const FVector4f J0 = StartValue - EndValue;
+			const FVector4f J1 = SpringVelocity + J0 * HalfDamping;
+
+			const FVector4f Offset = (J0 + J1 * DeltaTime) * Decay;
+			SpringVelocity = (SpringVelocity - J1 * (HalfDamping * DeltaTime)) * Decay;
+			StartValue = EndValue + Offset;
+
+			bIsSettled = Offset.SizeSquared() < FMath::Square(SettleTolerance) && SpringVelocity.SizeSquared() < FMath::Square(SettleTolerance);
+		}
+	}
+
+	if (bIsSettled)
+	{
+		StartValue = EndValue;
+		SpringVelocity = FVector4f(0.f, 0.f, 0.f, 0.f);
+		bIsSpringAsleep = true;
+	}
+
+	const FVector4 Current = GetStartValue();
+
+	if (Action.IsBound())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TweenerApplyCustomAction);
+		Action.Broadcast(ObjectPtr.Get(false), Current.X, Current.X);
+	}
+
+	SetAsRequiredPerCurrentTweenType(Current);
+
+	return bIsSettled;
 }
 
 void UTween::SetValueEnd() const
 {
-	SetAsRequiredPerCurrentTweenType(EndValue);
+	SetAsRequiredPerCurrentTweenType(GetEndValue());
 
 	//Same as
 	//bCompleteTweenThisStep = true;
@@ -1220,13 +1632,75 @@ void UTween::SetValueEnd() const
 
 void UTween::Activate()
 {
-	UWorld* World = WorldContextObject->GetWorld();
+	if (UTweenerSubsystem* Subsystem = FindSubsystem())
+	{
+		Subsystem->StartTween(this);
+	}
+}
+
+UTweenerSubsystem* UTween::FindSubsystem() const
+{
+	// tweens made without a world context live in the transient package, which has no world of its own
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : GetWorld();
+
+	return World ? World->GetSubsystem<UTweenerSubsystem>() : nullptr;
+}
+
+void UTween::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
 
-	UGameInstance* GameInstance = World->GetGameInstance();
+	// the cubic bezier curve is shared between tweens and dynamic delegate bindings live in the sparse delegate storage,
+	// so neither is counted here
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Groups.GetAllocatedSize());
 
-	if (UTweenerSubsystem* Subsystem = GameInstance->GetSubsystem<UTweenerSubsystem>())
+	if (NativeDelegates)
 	{
-		Subsystem->StartTween(this);
+		CumulativeResourceSize.AddDedicatedSystemMemoryBytes(sizeof(FTweenNativeDelegates)
+			+ NativeDelegates->Complete.GetAllocatedSize()
+			+ NativeDelegates->LoopComplete.GetAllocatedSize());
+	}
+}
+
+FTweenDelegate& UTween::OnComplete()
+{
+	if (!NativeDelegates)
+	{
+		LLM_SCOPE_BYTAG(Tweener);
+		NativeDelegates = MakeUnique<FTweenNativeDelegates>();
+	}
+
+	return NativeDelegates->Complete;
+}
+
+FTweenDelegate& UTween::OnLoopComplete()
+{
+	if (!NativeDelegates)
+	{
+		LLM_SCOPE_BYTAG(Tweener);
+		NativeDelegates = MakeUnique<FTweenNativeDelegates>();
+	}
+
+	return NativeDelegates->LoopComplete;
+}
+
+void UTween::BroadcastComplete()
+{
+	Complete.Broadcast();
+
+	if (NativeDelegates)
+	{
+		NativeDelegates->Complete.Broadcast();
+	}
+}
+
+void UTween::BroadcastLoopComplete()
+{
+	LoopComplete.Broadcast();
+
+	if (NativeDelegates)
+	{
+		NativeDelegates->LoopComplete.Broadcast();
 	}
 }
 
@@ -1236,9 +1710,12 @@ void UTween::Activate()
 void UTween::HandleLooping()
 {
 	Loops--;
+
+	TRACE_TWEEN_LOOP(*this);
+
 	if (LoopType == ELoopType::RestartFromBeginning)
 	{
-		SetAsRequiredPerCurrentTweenType(StartValue);
+		SetAsRequiredPerCurrentTweenType(GetStartValue());
 
 		PrepareForUse();
 	}
@@ -1249,8 +1726,8 @@ void UTween::HandleLooping()
 
 	if (LoopType == ELoopType::RestartFromBeginning || Loops % 2 == 1)
 	{
-		LoopComplete.Broadcast();
-		LoopCompleteDelegate.Broadcast();
+		SCOPE_CYCLE_COUNTER(STAT_TweenerEventDispatch);
+		BroadcastLoopComplete();
 	}
 
 	// kill our loop if we have no loops left and zero out the delay then prepare for use
@@ -1259,6 +1736,7 @@ void UTween::HandleLooping()
 
 	Delay = DelayBetweenLoops;
 	ElapsedTime = -Delay;
+	FixedStepUnits = 0;
 }
 
 void UTween::SetValueSceneComponent(const FVector4& Vec, USceneComponent& SceneComponent, ETweenType TweenType) 
@@ -1288,6 +1766,66 @@ void UTween::SetValueSceneComponent(const FVector4& Vec, USceneComponent& SceneC
 	}
 }
 
+void UTween::SetValueInstancedStaticMesh(const FVector4& Vec, UInstancedStaticMeshComponent& InstancedStaticMesh, ETweenType TweenType, int32 InstanceIndex)
+{
+	FTweenInstanceBatch* Batch = FindInstanceBatch(InstancedStaticMesh);
+
+	FTransform Transform;
+
+	if (Batch ? !Batch->GetInstanceTransform(InstancedStaticMesh, InstanceIndex, Transform) : !InstancedStaticMesh.GetInstanceTransform(InstanceIndex, Transform, false))
+	{
+		return;
+	}
+
+	const FTransform& ComponentTransform = InstancedStaticMesh.GetComponentTransform();
+
+	switch (TweenType)
+	{
+		case ETweenType::Location:
+			{
+				FTransform WorldTransform = Transform * ComponentTransform;
+				WorldTransform.SetLocation(FVector(Vec.X, Vec.Y, Vec.Z));
+				Transform = WorldTransform.GetRelativeTransform(ComponentTransform);
+			}
+			break;
+		case ETweenType::RelativeLocation:
+			Transform.SetLocation(FVector(Vec.X, Vec.Y, Vec.Z));
+			break;
+		case ETweenType::Rotation:
+			{
+				FTransform WorldTransform = Transform * ComponentTransform;
+				WorldTransform.SetRotation(FQuat(Vec.X, Vec.Y, Vec.Z, Vec.W));
+				Transform = WorldTransform.GetRelativeTransform(ComponentTransform);
+			}
+			break;
+		case ETweenType::RelativeRotation:
+			Transform.SetRotation(FQuat(Vec.X, Vec.Y, Vec.Z, Vec.W));
+			break;
+		case ETweenType::Scale:
+			{
+				FTransform WorldTransform = Transform * ComponentTransform;
+				WorldTransform.SetScale3D(FVector(Vec.X, Vec.Y, Vec.Z));
+				Transform = WorldTransform.GetRelativeTransform(ComponentTransform);
+			}
+			break;
+		case ETweenType::RelativeScale:
+			Transform.SetScale3D(FVector(Vec.X, Vec.Y, Vec.Z));
+			break;
+		default:
+			return;
+	}
+
+	// committed by the subsystem once all tweens have ticked
+	if (Batch)
+	{
+		Batch->SetInstanceTransform(InstancedStaticMesh, InstanceIndex, Transform);
+	}
+	else
+	{
+		InstancedStaticMesh.UpdateInstanceTransform(InstanceIndex, Transform, false, true, true);
+	}
+}
+
 void UTween::SetValueMaterial(const FVector4& Vec, UMaterialInstanceDynamic& Material, ETweenType TweenType, int32 ParameterIndex)
 {
 	switch (TweenType)
@@ -1437,23 +1975,36 @@ void UTween::SetAsRequiredPerCurrentTweenType(const FVector4& Vec) const
 		case ETweenTargetObjectType::SceneComponent:
 			if (USceneComponent* SceneComponent = Cast<USceneComponent>(Object))
 			{
+				SCOPE_CYCLE_COUNTER(STAT_TweenerApplySceneComponent);
 				SetValueSceneComponent(Vec, *SceneComponent, TweenType);
 			}
 			break;
+		case ETweenTargetObjectType::InstancedStaticMesh:
+			if (UInstancedStaticMeshComponent* InstancedStaticMesh = Cast<UInstancedStaticMeshComponent>(Object))
+			{
+				SCOPE_CYCLE_COUNTER(STAT_TweenerApplyInstancedStaticMesh);
+				SetValueInstancedStaticMesh(Vec, *InstancedStaticMesh, TweenType, ParameterIndex);
+			}
+			break;
 		case ETweenTargetObjectType::Material:
 			if (UMaterialInstanceDynamic* Material = Cast<UMaterialInstanceDynamic>(Object))
 			{
+				SCOPE_CYCLE_COUNTER(STAT_TweenerApplyMaterial);
 				SetValueMaterial(Vec, *Material, TweenType, ParameterIndex);
 			}
 			break;
 		case ETweenTargetObjectType::Widget:
 			if (UWidget* Widget = Cast<UWidget>(Object))
 			{
+				SCOPE_CYCLE_COUNTER(STAT_TweenerApplyWidget);
 				SetValueWidget(Vec, *Widget, TweenType);
 			}
+			break;
 		case ETweenTargetObjectType::Property:
-			SetValueProperty(Vec, *Object, TweenType, CachedProperty);
-
+			{
+				SCOPE_CYCLE_COUNTER(STAT_TweenerApplyProperty);
+				SetValueProperty(Vec, *Object, TweenType, CachedProperty);
+			}
 			break;
 		default:
 			break;
@@ -1467,25 +2018,12 @@ void UTween::ReverseTween()
 {
 	bIsRunningInReverse = !bIsRunningInReverse;
 	ElapsedTime = Duration - ElapsedTime;
+	FixedStepUnits = INDEX_NONE;
 }
 
 bool UTween::Stop(bool bBringToCompletion, bool bIncludeChain)
 {
-	UWorld* World = GetWorld();
-
-	if(!World)
-	{
-		return false;
-	}
-	
-	UGameInstance* GameInstance = World->GetGameInstance();
-
-	if (!GameInstance)
-	{
-		return false;
-	}
-
-	if(UTweenerSubsystem *Subsystem = GameInstance->GetSubsystem<UTweenerSubsystem>())
+	if (UTweenerSubsystem* Subsystem = FindSubsystem())
 	{
 		return Subsystem->StopTween(this, bBringToCompletion, bIncludeChain);
 	}
@@ -1495,21 +2033,7 @@ bool UTween::Stop(bool bBringToCompletion, bool bIncludeChain)
 
 bool UTween::IsActive() const
 {
-	UWorld* World = GetWorld();
-
-	if (!World)
-	{
-		return false;
-	}
-
-	UGameInstance* GameInstance = World->GetGameInstance();
-
-	if (!GameInstance)
-	{
-		return false;
-	}
-
-	if (UTweenerSubsystem* Subsystem = GameInstance->GetSubsystem<UTweenerSubsystem>())
+	if (UTweenerSubsystem* Subsystem = FindSubsystem())
 	{
 		return Subsystem->IsTweenActive(this);
 	}
@@ -1527,6 +2051,103 @@ UTween * UTween::SetEaseType(const EEaseType InEaseType)
 	return this;
 }
 
+/// <summary>
+/// chainable. Eases the tween with a cubic-bezier curve, shared with any other tween using the same control points.
+/// </summary>
+UTween* UTween::SetCubicBezier(float X1, float Y1, float X2, float Y2)
+{
+	EaseType = EEaseType::CubicBezier;
+	CubicBezierCurve = FTweenCubicBezierCurve::FindOrCreate(FTweenCubicBezierKey(X1, Y1, X2, Y2));
+	return this;
+}
+
+/// <summary>
+/// chainable. drives the tween with a critically damped spring, Duration and EaseType are ignored.
+/// </summary>
+UTween* UTween::SetSpring(float HalfLife)
+{
+	bIsSpring = true;
+	SpringHalfLife = HalfLife;
+	return this;
+}
+
+void UTween::SetSpringTargetVector(FVector VectorTo)
+{
+	SetSpringTarget(FVector4(VectorTo));
+}
+
+void UTween::SetSpringTargetRotation(FQuat RotationTo)
+{
+	SetSpringTarget(FVector4(RotationTo.X, RotationTo.Y, RotationTo.Z, RotationTo.W));
+}
+
+void UTween::SetSpringTargetColor(FLinearColor ColorTo)
+{
+	SetSpringTarget(ColorTo);
+}
+
+void UTween::SetSpringTargetScalar(float ScalarTo)
+{
+	SetSpringTarget(FVector4(ScalarTo));
+}
+
+void UTween::SetStartValue(const FVector4& Value)
+{
+	const FVector4 End = GetEndValue();
+
+	ValueOrigin = GetTargetValueType() == ETargetValueType::Vector ? FVector(Value) : FVector::ZeroVector;
+
+	StartValue = ToStoredValue(Value);
+	EndValue = ToStoredValue(End);
+}
+
+void UTween::SetSpringTarget(const FVector4& Target)
+{
+	// a spring that is kept awake never gets a new start value, rebase on where it is now so the float offsets stay
+	// small however far it has travelled from where it started
+	if (GetTargetValueType() == ETargetValueType::Vector)
+	{
+		SetStartValue(GetStartValue());
+	}
+
+	if (bIsRelativeTween)
+	{
+		// relative to where the spring started rather than where it is now. EndValue was built from that start and the
+		// previous target, so swap the target over
+		const FVector4 End = GetEndValue();
+
+		if (GetTargetValueType() == ETargetValueType::Quat)
+		{
+			const FQuat SpringStart = FQuat(End.X, End.Y, End.Z, End.W) * FQuat(TargetValue.X, TargetValue.Y, TargetValue.Z, TargetValue.W).Inverse();
+			const FQuat NewEnd = SpringStart * FQuat(Target.X, Target.Y, Target.Z, Target.W);
+
+			SetEndValue(FVector4(NewEnd.X, NewEnd.Y, NewEnd.Z, NewEnd.W));
+		}
+		else
+		{
+			SetEndValue(End - TargetValue + Target);
+		}
+
+		TargetValue = Target;
+	}
+	else
+	{
+		TargetValue = Target;
+		CalculateEndValue();
+	}
+
+	const bool bWasAsleep = bIsSpringAsleep;
+	bIsSpringAsleep = false;
+
+	// a settled spring sleeps in the subsystem and picks the new target up on its next update. One that was stopped
+	// has left it, put it back rather than making a new tween
+	if (bWasAsleep && !IsActive())
+	{
+		Delay = 0.f;
+		Activate();
+	}
+}
+
 // <summary>
 /// chainable. set the loop type for the tween. a single pingpong loop means going from start-finish-start.
 /// </summary>
@@ -1554,6 +2175,7 @@ UTween* UTween::SetDelay(float InDelay)
 {
 	Delay = InDelay;
 	ElapsedTime = -InDelay;
+	FixedStepUnits = INDEX_NONE;
 	return this;
 }
 
@@ -1569,3 +2191,125 @@ UTween* UTween::SetTimeScaleIndependent()
 }
 
 
+/// <summary>
+/// adds the tween to a group that can be paused, stopped or time scaled as one through the subsystem
+/// </summary>
+/// <returns>The Tween</returns>
+UTween* UTween::AddToGroup(FName Group)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	if (UTweenerSubsystem* Subsystem = FindSubsystem())
+	{
+		Subsystem->AddTweenToGroup(this, Group);
+	}
+	else if (!Group.IsNone())
+	{
+		Groups.AddUnique(Group);
+	}
+	return this;
+}
+
+
+/// <summary>
+/// sets a time scale applied on top of the tween's time domain
+/// </summary>
+/// <returns>The Tween</returns>
+UTween* UTween::SetTimeScale(float InTimeScale)
+{
+	TimeScale = FMath::Max(InTimeScale, 0.f);
+	return this;
+}
+
+
+/// <summary>
+/// lets the subsystem update the tween less often while its target is insignificant
+/// </summary>
+/// <returns>The Tween</returns>
+UTween* UTween::SetSignificanceThrottled(bool bInIsSignificanceThrottled)
+{
+	bIsSignificanceThrottled = bInIsSignificanceThrottled;
+	return this;
+}
+
+
+/// <summary>
+/// marks the tween as purely visual, so it can be skipped where nothing is rendered
+/// </summary>
+/// <returns>The Tween</returns>
+UTween* UTween::SetCosmetic(bool bInIsCosmetic)
+{
+	bIsCosmetic = bInIsCosmetic;
+	return this;
+}
+
+bool UTween::IsCosmetic() const
+{
+	return bIsCosmetic || TargetObjectType == ETweenTargetObjectType::Widget || TargetObjectType == ETweenTargetObjectType::Material;
+}
+
+bool UTween::ShouldStripAsCosmetic() const
+{
+	if (!GTweenerStripCosmeticTweens || !IsCosmetic())
+	{
+		return false;
+	}
+
+	if (!FApp::CanEverRender())
+	{
+		return true;
+	}
+
+	const UWorld* World = GetWorld();
+
+	return World && World->GetNetMode() == NM_DedicatedServer;
+}
+
+
+/// <summary>
+/// sets whether the tween can be deferred when the frame's tween budget has been spent
+/// </summary>
+/// <returns>The Tween</returns>
+UTween* UTween::SetPriority(ETweenPriority InPriority)
+{
+	Priority = InPriority;
+	return this;
+}
+
+
+/// <summary>
+/// sets the clock the tween runs on, moving it over if it is already running
+/// </summary>
+/// <returns>The Tween</returns>
+UTween* UTween::SetTimeDomain(FName InTimeDomain)
+{
+	if (UTweenerSubsystem* Subsystem = FindSubsystem())
+	{
+		Subsystem->MoveTween(this, TickGroup, InTimeDomain);
+	}
+	else
+	{
+		TimeDomain = InTimeDomain;
+	}
+	return this;
+}
+
+
+/// <summary>
+/// sets the tick group the tween is updated in, moving it over if it is already running
+/// </summary>
+/// <returns>The Tween</returns>
+UTween* UTween::SetTickGroup(ETickingGroup InTickGroup)
+{
+	if (UTweenerSubsystem* Subsystem = FindSubsystem())
+	{
+		Subsystem->MoveTween(this, InTickGroup, TimeDomain);
+	}
+	else
+	{
+		TickGroup = InTickGroup;
+	}
+	return this;
+}
+
+
@@ -0,0 +1,139 @@
+#include "TweenCubicBezier.h"
+
+#include "TweenerStats.h"
+
+namespace
+{
+	struct FBezierCoefficients
+	{
+		float A, B, C;
+
+		FBezierCoefficients(float P1, float P2)
+		{
+			C = 3.f * P1;
+			B = 3.f * (P2 - P1) - C;
+			A = 1.f - C - B;
+		}
+
+		float Sample(float T) const
+		{
+			return ((A * T + B) * T + C) * T;
+		}
+
+		float SampleDerivative(float T) const
+		{
+			return (3.f * A * T + 2.f * B) * T + C;
+		}
+	};
+
+	// Curves are shared between every tween using the same control points, and die with the last of them
+	TMap<FTweenCubicBezierKey, TWeakPtr<const FTweenCubicBezierCurve>>& GetCurveRegistry()
+	{
+		static TMap<FTweenCubicBezierKey, TWeakPtr<const FTweenCubicBezierCurve>> Registry;
+		return Registry;
+	}
+}
+
+FTweenCubicBezierCurve::FTweenCubicBezierCurve(const FTweenCubicBezierKey& InKey)
+	: Key(InKey)
+{
+	for (int32 Index = 0; Index < NumSamples; ++Index)
+	{
+		Samples[Index] = Solve(Key, static_cast<float>(Index) / (NumSamples - 1));
+	}
+}
+
+float FTweenCubicBezierCurve::Solve(const FTweenCubicBezierKey& Key, float X)
+{
+	const FBezierCoefficients CurveX(Key.X1, Key.X2);
+	const FBezierCoefficients CurveY(Key.Y1, Key.Y2);
+
+	if (X <= 0.f || X >= 1.f)
+	{
+		return FMath::Clamp(X, 0.f, 1.f);
+	}
+
+	constexpr float Epsilon = 1e-6f;
+
+	// Newton-Raphson first, it converges in a handful of steps unless the slope flattens out
+	float T = X;
+	for (int32 Iteration = 0; Iteration < 8; ++Iteration)
+	{
+		const float Error = CurveX.Sample(T) - X;
+		if (FMath::Abs(Error) < Epsilon)
+		{
+			return CurveY.Sample(T);
+		}
+
+		const float Derivative = CurveX.SampleDerivative(T);
+		if (FMath::Abs(Derivative) < Epsilon)
+		{
+			break;
+		}
+
+		T -= Error / Derivative;
+	}
+
+	// Fall back to bisection, x(t) is monotonic as X1 and X2 are clamped to [0,1]
+	float Low = 0.f;
+	float High = 1.f;
+	T = X;
+
+	while (Low < High)
+	{
+		const float SampleX = CurveX.Sample(T);
+		if (FMath::Abs(SampleX - X) < Epsilon)
+		{
+			break;
+		}
+
+		if (X > SampleX)
+		{
+			Low = T;
+		}
+		else
+		{
+			High = T;
+		}
+
+		const float NextT = (High - Low) * 0.5f + Low;
+		if (NextT == T)
+		{
+			break;
+		}
+		T = NextT;
+	}
+
+	return CurveY.Sample(T);
+}
+
+TSharedRef<const FTweenCubicBezierCurve> FTweenCubicBezierCurve::FindOrCreate(const FTweenCubicBezierKey& Key)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	check(IsInGameThread());
+
+	TMap<FTweenCubicBezierKey, TWeakPtr<const FTweenCubicBezierCurve>>& Registry = GetCurveRegistry();
+
+	if (const TWeakPtr<const FTweenCubicBezierCurve>* Existing = Registry.Find(Key))
+	{
+		if (TSharedPtr<const FTweenCubicBezierCurve> Curve = Existing->Pin())
+		{
+			return Curve.ToSharedRef();
+		}
+	}
+
+	// Drop curves nobody is using any more before adding, so the registry stays the size of the working set
+	for (auto It = Registry.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TSharedRef<const FTweenCubicBezierCurve> Curve = MakeShared<const FTweenCubicBezierCurve>(Key);
+	Registry.Add(Key, Curve);
+
+	return Curve;
+}
@@ -0,0 +1,121 @@
+#include "TweenInstanceBatch.h"
+
+#include "TweenerStats.h"
+#include "Components/InstancedStaticMeshComponent.h"
+
+bool FTweenInstanceBatch::GetInstanceTransform(UInstancedStaticMeshComponent& Component, int32 InstanceIndex, FTransform& OutTransform) const
+{
+	if (const TMap<int32, FTransform>* PendingInstances = PendingComponents.Find(&Component))
+	{
+		if (const FTransform* PendingTransform = PendingInstances->Find(InstanceIndex))
+		{
+			OutTransform = *PendingTransform;
+			return true;
+		}
+	}
+
+	return Component.GetInstanceTransform(InstanceIndex, OutTransform, false);
+}
+
+void FTweenInstanceBatch::SetInstanceTransform(UInstancedStaticMeshComponent& Component, int32 InstanceIndex, const FTransform& Transform)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	if (InstanceIndex < 0 || InstanceIndex >= Component.GetInstanceCount())
+	{
+		return;
+	}
+
+	PendingComponents.FindOrAdd(&Component).Add(InstanceIndex, Transform);
+}
+
+void FTweenInstanceBatch::Flush()
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	for (TPair<TWeakObjectPtr<UInstancedStaticMeshComponent>, TMap<int32, FTransform>>& Pair : PendingComponents)
+	{
+		UInstancedStaticMeshComponent* Component = Pair.Key.Get();
+		const TMap<int32, FTransform>& PendingInstances = Pair.Value;
+
+		if (!Component || PendingInstances.Num() == 0)
+		{
+			continue;
+		}
+
+		// instances may have been removed since they were queued
+		const int32 NumInstances = Component->GetInstanceCount();
+
+		ScratchIndices.Reset(PendingInstances.Num());
+
+		for (const TPair<int32, FTransform>& Instance : PendingInstances)
+		{
+			if (Instance.Key < NumInstances)
+			{
+				ScratchIndices.Add(Instance.Key);
+			}
+		}
+
+		if (ScratchIndices.Num() == 0)
+		{
+			continue;
+		}
+
+		ScratchIndices.Sort();
+
+		// a batch update takes a contiguous range. Short gaps are cheaper to fill with the current transforms than to
+		// split over, anything longer starts a new range so a few tweens at either end don't upload the whole component
+		constexpr int32 MaxFilledGap = 16;
+
+		int32 FirstIndex = ScratchIndices[0];
+
+		for (int32 Index = 1; Index < ScratchIndices.Num(); ++Index)
+		{
+			if (ScratchIndices[Index] - ScratchIndices[Index - 1] - 1 > MaxFilledGap)
+			{
+				FlushRange(*Component, PendingInstances, FirstIndex, ScratchIndices[Index - 1]);
+				FirstIndex = ScratchIndices[Index];
+			}
+		}
+
+		FlushRange(*Component, PendingInstances, FirstIndex, ScratchIndices.Last());
+
+		Component->MarkRenderStateDirty();
+	}
+
+	PendingComponents.Reset();
+}
+
+void FTweenInstanceBatch::FlushRange(UInstancedStaticMeshComponent& Component, const TMap<int32, FTransform>& PendingInstances, int32 FirstIndex, int32 LastIndex)
+{
+	ScratchTransforms.Reset(LastIndex - FirstIndex + 1);
+
+	for (int32 InstanceIndex = FirstIndex; InstanceIndex <= LastIndex; ++InstanceIndex)
+	{
+		FTransform& Transform = ScratchTransforms.AddDefaulted_GetRef();
+
+		if (const FTransform* PendingTransform = PendingInstances.Find(InstanceIndex))
+		{
+			Transform = *PendingTransform;
+		}
+		else
+		{
+			Component.GetInstanceTransform(InstanceIndex, Transform, false);
+		}
+	}
+
+	// the render state is marked dirty once per component after its last range
+	Component.BatchUpdateInstancesTransforms(FirstIndex, ScratchTransforms, false, false, true);
+}
+
+SIZE_T FTweenInstanceBatch::GetAllocatedSize() const
+{
+	SIZE_T Size = PendingComponents.GetAllocatedSize() + ScratchIndices.GetAllocatedSize() + ScratchTransforms.GetAllocatedSize();
+
+	for (const TPair<TWeakObjectPtr<UInstancedStaticMeshComponent>, TMap<int32, FTransform>>& Pair : PendingComponents)
+	{
+		Size += Pair.Value.GetAllocatedSize();
+	}
+
+	return Size;
+}
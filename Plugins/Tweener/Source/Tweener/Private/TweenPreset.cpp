@@ -0,0 +1,130 @@
+#include "TweenPreset.h"
+
+#include "TweenerStats.h"
+#include "UObject/ObjectSaveContext.h"
+
+#define LOCTEXT_NAMESPACE "TweenPreset"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTweenPreset, Log, All);
+
+FVector4 UTweenPreset::GetTargetValue(const FTransform& Target) const
+{
+	switch (TweenType)
+	{
+		case ETweenType::Rotation:
+		case ETweenType::RelativeRotation:
+		{
+			const FQuat Rotation = Target.GetRotation();
+			return FVector4(Rotation.X, Rotation.Y, Rotation.Z, Rotation.W);
+		}
+
+		case ETweenType::Scale:
+		case ETweenType::RelativeScale:
+			return FVector4(Target.GetScale3D());
+
+		default:
+			return FVector4(Target.GetLocation());
+	}
+}
+
+bool UTweenPreset::Validate(TArray<FText>& OutErrors) const
+{
+	const int32 NumErrors = OutErrors.Num();
+
+	switch (TweenType)
+	{
+		case ETweenType::Location:
+		case ETweenType::RelativeLocation:
+		case ETweenType::Rotation:
+		case ETweenType::RelativeRotation:
+		case ETweenType::Scale:
+		case ETweenType::RelativeScale:
+			break;
+
+		default:
+			OutErrors.Add(LOCTEXT("TweenType", "Presets only drive location, rotation or scale."));
+			break;
+	}
+
+	if (Duration <= 0.f)
+	{
+		OutErrors.Add(LOCTEXT("Duration", "Duration must be greater than zero."));
+	}
+
+	if (Delay < 0.f || DelayBetweenLoops < 0.f)
+	{
+		OutErrors.Add(LOCTEXT("Delay", "Delays can't be negative."));
+	}
+
+	if (LoopType != ELoopType::None && Loops < 0)
+	{
+		OutErrors.Add(LOCTEXT("Loops", "Loops can't be negative, use 0 to loop forever."));
+	}
+
+	if (EaseType == EEaseType::CubicBezier && (CubicBezier.X < 0.f || CubicBezier.X > 1.f || CubicBezier.Z < 0.f || CubicBezier.Z > 1.f))
+	{
+		OutErrors.Add(LOCTEXT("CubicBezier", "Cubic bezier X1 and X2 must be between 0 and 1."));
+	}
+
+	return OutErrors.Num() == NumErrors;
+}
+
+void UTweenPreset::BakeCurve()
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	// owned by the preset rather than the shared cache, which is game thread only and presets can load off it
+	if (EaseType == EEaseType::CubicBezier)
+	{
+		CubicBezierCurve = MakeShared<const FTweenCubicBezierCurve>(FTweenCubicBezierKey(CubicBezier.X, CubicBezier.Y, CubicBezier.Z, CubicBezier.W));
+	}
+	else
+	{
+		CubicBezierCurve.Reset();
+	}
+}
+
+void UTweenPreset::PostLoad()
+{
+	Super::PostLoad();
+
+	BakeCurve();
+}
+
+void UTweenPreset::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	if (!SaveContext.IsCooking())
+	{
+		return;
+	}
+
+	TArray<FText> Errors;
+
+	if (!Validate(Errors))
+	{
+		for (const FText& Error : Errors)
+		{
+			UE_LOG(LogTweenPreset, Error, TEXT("%s: %s"), *GetPathName(), *Error.ToString());
+		}
+	}
+}
+
+#if WITH_EDITOR
+void UTweenPreset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BakeCurve();
+}
+
+EDataValidationResult UTweenPreset::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	const EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+
+	return Validate(ValidationErrors) ? Result : EDataValidationResult::Invalid;
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
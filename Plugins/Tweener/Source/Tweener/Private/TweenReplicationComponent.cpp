@@ -0,0 +1,257 @@
+#include "TweenReplicationComponent.h"
+
+#include "TweenerSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+
+UTweenReplicationComponent::UTweenReplicationComponent()
+{
+	SetIsReplicatedByDefault(true);
+
+	// only ticks on the server, to notice tweens that were stopped without completing
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickInterval = 0.1f;
+}
+
+void UTweenReplicationComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UTweenReplicationComponent, Descriptors);
+}
+
+UTween* UTweenReplicationComponent::StartReplicatedTween(UTween* Tween)
+{
+	if (!Tween || !GetOwner() || !GetOwner()->HasAuthority() || Tween->TargetObjectType != ETweenTargetObjectType::SceneComponent)
+	{
+		return nullptr;
+	}
+
+	USceneComponent* Target = Cast<USceneComponent>(Tween->ObjectPtr.Get());
+
+	if (!Target || Target->GetOwner() != GetOwner())
+	{
+		return nullptr;
+	}
+
+	UTweenerSubsystem* Subsystem = GetWorld()->GetSubsystem<UTweenerSubsystem>();
+
+	if (!Subsystem || !Subsystem->StartTween(Tween))
+	{
+		return nullptr;
+	}
+
+	FTweenReplicatedDescriptor& Descriptor = Descriptors.AddDefaulted_GetRef();
+	Descriptor.Id = NextId++;
+	Descriptor.Target = Target;
+	Descriptor.TweenType = Tween->TweenType;
+	Descriptor.EaseType = Tween->EaseType;
+	Descriptor.LoopType = Tween->LoopType;
+	Descriptor.Loops = Tween->Loops;
+	Descriptor.Duration = Tween->Duration;
+	Descriptor.Delay = Tween->Delay;
+	Descriptor.DelayBetweenLoops = Tween->DelayBetweenLoops;
+	Descriptor.StartValue = Tween->GetStartValue();
+	Descriptor.EndValue = Tween->GetEndValue();
+	Descriptor.ServerStartTime = GetServerWorldTimeSeconds();
+
+	if (Tween->CubicBezierCurve.IsValid())
+	{
+		const FTweenCubicBezierKey& Key = Tween->CubicBezierCurve->GetKey();
+		Descriptor.CubicBezier = FVector4(Key.X1, Key.Y1, Key.X2, Key.Y2);
+	}
+
+	Tweens.Add(Descriptor.Id, Tween);
+	Tween->OnComplete().AddUObject(this, &UTweenReplicationComponent::OnServerTweenComplete, Descriptor.Id);
+
+	SetComponentTickEnabled(true);
+
+	return Tween;
+}
+
+void UTweenReplicationComponent::OnServerTweenComplete(int32 Id)
+{
+	Tweens.Remove(Id);
+
+	Descriptors.RemoveAll([Id](const FTweenReplicatedDescriptor& Descriptor)
+	{
+		return Descriptor.Id == Id;
+	});
+}
+
+void UTweenReplicationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	for (int32 Index = Descriptors.Num() - 1; Index >= 0; --Index)
+	{
+		const FTweenReplicatedDescriptor& Descriptor = Descriptors[Index];
+
+		if (IsTweenActive(Tweens.FindRef(Descriptor.Id)))
+		{
+			continue;
+		}
+
+		// stopped without completing, clients would otherwise carry on to the end value
+		if (Descriptor.Target)
+		{
+			MulticastCorrectTarget(Descriptor.Id, Descriptor.Target, Descriptor.Target->GetRelativeTransform());
+		}
+
+		Tweens.Remove(Descriptor.Id);
+		Descriptors.RemoveAt(Index);
+	}
+
+	if (Descriptors.Num() == 0)
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UTweenReplicationComponent::MulticastCorrectTarget_Implementation(int32 Id, USceneComponent* Target, FTransform RelativeTransform)
+{
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	if (UTween* Tween = Tweens.FindRef(Id))
+	{
+		Tween->Stop();
+		Tweens.Remove(Id);
+	}
+
+	if (Target)
+	{
+		Target->SetRelativeTransform(RelativeTransform);
+	}
+}
+
+void UTweenReplicationComponent::OnRep_Descriptors()
+{
+	// forget local tweens that have finished and are no longer replicated, ones still running are left to finish
+	// on their own unless the server sends a correction
+	for (auto It = Tweens.CreateIterator(); It; ++It)
+	{
+		const int32 Id = It.Key();
+
+		const bool bIsReplicated = Descriptors.ContainsByPredicate([Id](const FTweenReplicatedDescriptor& Descriptor)
+		{
+			return Descriptor.Id == Id;
+		});
+
+		if (!bIsReplicated && !IsTweenActive(It.Value()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const FTweenReplicatedDescriptor& Descriptor : Descriptors)
+	{
+		if (!Tweens.Contains(Descriptor.Id))
+		{
+			StartLocalTween(Descriptor);
+		}
+	}
+}
+
+void UTweenReplicationComponent::StartLocalTween(const FTweenReplicatedDescriptor& Descriptor)
+{
+	if (!Descriptor.Target)
+	{
+		return;
+	}
+
+	UTweenerSubsystem* Subsystem = GetWorld()->GetSubsystem<UTweenerSubsystem>();
+
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	UTween* Tween = UTween::NewTweenSceneComponent(Descriptor.Target, Descriptor.TweenType, Descriptor.EndValue, false,
+		Descriptor.Duration, Descriptor.EaseType, Descriptor.LoopType, Descriptor.Loops, Descriptor.DelayBetweenLoops, this);
+
+	if (!Tween)
+	{
+		return;
+	}
+
+	Tween->SetDelay(Descriptor.Delay);
+
+	if (Descriptor.EaseType == EEaseType::CubicBezier)
+	{
+		Tween->SetCubicBezier(Descriptor.CubicBezier.X, Descriptor.CubicBezier.Y, Descriptor.CubicBezier.Z, Descriptor.CubicBezier.W);
+	}
+
+	if (!Subsystem->StartTween(Tween))
+	{
+		return;
+	}
+
+	// play from where the server started, not from wherever replicated movement left the target
+	Tween->SetStartValue(Descriptor.StartValue);
+	Tween->SetEndValue(Descriptor.EndValue);
+
+	Tweens.Add(Descriptor.Id, Tween);
+
+	const float Elapsed = static_cast<float>(GetServerWorldTimeSeconds() - Descriptor.ServerStartTime);
+
+	if (Elapsed > 0.f)
+	{
+		FastForward(*Tween, Elapsed);
+	}
+}
+
+bool UTweenReplicationComponent::IsTweenActive(const UTween* Tween) const
+{
+	// asked of this component's world, UTween::IsActive can't find one for tweens made without a world context
+	const UWorld* World = GetWorld();
+	const UTweenerSubsystem* Subsystem = World ? World->GetSubsystem<UTweenerSubsystem>() : nullptr;
+
+	return Tween && Subsystem && Subsystem->IsTweenActive(Tween);
+}
+
+double UTweenReplicationComponent::GetServerWorldTimeSeconds() const
+{
+	const UWorld* World = GetWorld();
+	const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+
+	return GameState ? GameState->GetServerWorldTimeSeconds() : (World ? World->GetTimeSeconds() : 0.0);
+}
+
+void UTweenReplicationComponent::FastForward(UTween& Tween, float Seconds)
+{
+	// a tween's Tick stops at the end of each loop, so step through loop by loop
+	const float LoopPeriod = Tween.Duration + Tween.DelayBetweenLoops;
+
+	const bool bLoopsForever = Tween.LoopType != ELoopType::None && Tween.Loops <= 0;
+
+	for (int32 Step = 0; Seconds > 0.f; ++Step)
+	{
+		// whole ping-pong cycles of an endless tween change nothing, skip straight past them
+		if (bLoopsForever && Step == 1 && LoopPeriod > 0.f)
+		{
+			Seconds = FMath::Fmod(Seconds, 2.f * LoopPeriod);
+		}
+
+		const float StepSeconds = FMath::Min(Seconds, Tween.Duration - Tween.ElapsedTime);
+
+		Seconds -= StepSeconds;
+
+		if (Tween.Tick(StepSeconds, StepSeconds))
+		{
+			Tween.Stop(true);
+			break;
+		}
+
+		if (StepSeconds <= 0.f)
+		{
+			break;
+		}
+	}
+}
@@ -0,0 +1,129 @@
+#include "TweenRollbackBuffer.h"
+
+#include "Tween.h"
+
+void FTweenSnapshotRecord::Capture(UTween& InTween, uint8 InTickGroup, uint16 InDomainIndex)
+{
+	Tween = &InTween;
+
+	TargetValue = InTween.TargetValue;
+	ValueOrigin = InTween.ValueOrigin;
+	StartValue = InTween.StartValue;
+	EndValue = InTween.EndValue;
+	SpringVelocity = InTween.SpringVelocity;
+
+	ElapsedTime = InTween.ElapsedTime;
+	Delay = InTween.Delay;
+	TimeScale = InTween.TimeScale;
+	PendingDeltaTime = InTween.PendingDeltaTime;
+	PendingUnscaledDeltaTime = InTween.PendingUnscaledDeltaTime;
+
+	Loops = InTween.Loops;
+
+	DomainIndex = InDomainIndex;
+	TickGroup = InTickGroup;
+
+	LoopType = static_cast<uint8>(InTween.LoopType);
+
+	bIsRunningInReverse = InTween.bIsRunningInReverse;
+	bIsPaused = InTween.bIsPaused;
+	bIsSpringAsleep = InTween.bIsSpringAsleep;
+}
+
+void FTweenSnapshotRecord::Restore() const
+{
+	Tween->TargetValue = TargetValue;
+	Tween->ValueOrigin = ValueOrigin;
+	Tween->StartValue = StartValue;
+	Tween->EndValue = EndValue;
+	Tween->SpringVelocity = SpringVelocity;
+
+	Tween->ElapsedTime = ElapsedTime;
+	Tween->FixedStepUnits = INDEX_NONE;
+	Tween->Delay = Delay;
+	Tween->TimeScale = TimeScale;
+	Tween->PendingDeltaTime = PendingDeltaTime;
+	Tween->PendingUnscaledDeltaTime = PendingUnscaledDeltaTime;
+
+	Tween->Loops = Loops;
+
+	Tween->LoopType = static_cast<ELoopType>(LoopType);
+
+	Tween->bIsRunningInReverse = bIsRunningInReverse;
+	Tween->bIsPaused = bIsPaused;
+	Tween->bIsSpringAsleep = bIsSpringAsleep;
+	Tween->bIsPendingRemoval = false;
+}
+
+void FTweenRollbackBuffer::Initialize(int32 InNumFrames, int32 InMaxTweensPerFrame)
+{
+	MaxTweensPerFrame = FMath::Max(InMaxTweensPerFrame, 0);
+
+	Slots.Reset();
+	Slots.SetNum(FMath::Max(InNumFrames, 0));
+
+	Records.Reset();
+	Records.SetNum(Slots.Num() * MaxTweensPerFrame);
+}
+
+int32 FTweenRollbackBuffer::GetSlotIndex(int32 Frame) const
+{
+	const int32 NumSlots = Slots.Num();
+	return ((Frame % NumSlots) + NumSlots) % NumSlots;
+}
+
+TArrayView<FTweenSnapshotRecord> FTweenRollbackBuffer::BeginCapture(int32 Frame, int32 NumRecords)
+{
+	if (!IsInitialized() || NumRecords > MaxTweensPerFrame)
+	{
+		return TArrayView<FTweenSnapshotRecord>();
+	}
+
+	const int32 SlotIndex = GetSlotIndex(Frame);
+
+	FFrameSlot& Slot = Slots[SlotIndex];
+	Slot.Frame = Frame;
+	Slot.NumRecords = NumRecords;
+
+	return TArrayView<FTweenSnapshotRecord>(Records.GetData() + SlotIndex * MaxTweensPerFrame, NumRecords);
+}
+
+bool FTweenRollbackBuffer::Find(int32 Frame, TArrayView<const FTweenSnapshotRecord>& OutRecords) const
+{
+	if (!IsInitialized())
+	{
+		return false;
+	}
+
+	const int32 SlotIndex = GetSlotIndex(Frame);
+
+	const FFrameSlot& Slot = Slots[SlotIndex];
+
+	if (Slot.Frame != Frame)
+	{
+		return false;
+	}
+
+	OutRecords = TArrayView<const FTweenSnapshotRecord>(Records.GetData() + SlotIndex * MaxTweensPerFrame, Slot.NumRecords);
+
+	return true;
+}
+
+void FTweenRollbackBuffer::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	// tweens that have finished since a frame was captured are only kept alive by the ring
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		if (Slots[SlotIndex].Frame == INDEX_NONE)
+		{
+			continue;
+		}
+
+		FTweenSnapshotRecord* SlotRecords = Records.GetData() + SlotIndex * MaxTweensPerFrame;
+
+		for (int32 Index = 0; Index < Slots[SlotIndex].NumRecords; ++Index)
+		{
+			Collector.AddReferencedObject(SlotRecords[Index].Tween);
+		}
+	}
+}
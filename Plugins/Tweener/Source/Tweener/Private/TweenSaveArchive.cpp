@@ -0,0 +1,305 @@
+#include "TweenSaveArchive.h"
+
+#include "Tween.h"
+#include "TweenerStats.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/SoftObjectPath.h"
+
+namespace TweenSaveArchive
+{
+	static constexpr uint32 Magic = 0x4E575454; // TTWN
+
+	/** Collects unique entries for one of the archive's tables */
+	template <typename ElementType>
+	struct FTable
+	{
+		TArray<ElementType> Elements;
+		TMap<ElementType, int32> Indices;
+
+		int32 Add(const ElementType& Element)
+		{
+			if (const int32* Index = Indices.Find(Element))
+			{
+				return *Index;
+			}
+
+			return Indices.Add(Element, Elements.Add(Element));
+		}
+	};
+}
+
+void FTweenSaveArchive::Write(const TArray<UTween*>& ActiveTweens, TArray<uint8>& OutData)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	// give every saved tween, and everything chained after it, a record index up front so NextRecord can be filled in
+	TArray<UTween*> Tweens;
+	TMap<UTween*, int32> RecordIndices;
+
+	Tweens.Reserve(ActiveTweens.Num());
+	RecordIndices.Reserve(ActiveTweens.Num());
+
+	for (UTween* ActiveTween : ActiveTweens)
+	{
+		for (UTween* Tween = ActiveTween; Tween && !RecordIndices.Contains(Tween); Tween = Tween->NextTween)
+		{
+			if (Tween->TargetObjectType == ETweenTargetObjectType::CustomAction || !Tween->ObjectPtr.Get())
+			{
+				break;
+			}
+
+			RecordIndices.Add(Tween, Tweens.Add(Tween));
+		}
+	}
+
+	TweenSaveArchive::FTable<FString> Targets;
+	TweenSaveArchive::FTable<FName> Names;
+	TArray<int32> GroupNames;
+
+	TArray<FTweenSaveRecord> Records;
+	Records.SetNumZeroed(Tweens.Num());
+
+	for (int32 Index = 0; Index < Tweens.Num(); ++Index)
+	{
+		const UTween& Tween = *Tweens[Index];
+		FTweenSaveRecord& Record = Records[Index];
+
+		Record.TargetValue = Tween.TargetValue;
+		Record.StartValue = Tween.GetStartValue();
+		Record.EndValue = Tween.GetEndValue();
+		Record.SpringVelocity = FVector4(Tween.SpringVelocity);
+
+		if (Tween.CubicBezierCurve.IsValid())
+		{
+			const FTweenCubicBezierKey& Key = Tween.CubicBezierCurve->GetKey();
+			Record.CubicBezier[0] = Key.X1;
+			Record.CubicBezier[1] = Key.Y1;
+			Record.CubicBezier[2] = Key.X2;
+			Record.CubicBezier[3] = Key.Y2;
+		}
+
+		Record.Duration = Tween.Duration;
+		Record.Delay = Tween.Delay;
+		Record.DelayBetweenLoops = Tween.DelayBetweenLoops;
+		Record.ElapsedTime = Tween.ElapsedTime;
+		Record.TimeScale = Tween.TimeScale;
+		Record.SpringHalfLife = Tween.SpringHalfLife;
+
+		Record.Loops = Tween.Loops;
+		Record.ParameterIndex = Tween.ParameterIndex;
+
+		Record.TargetIndex = Targets.Add(FSoftObjectPath(Tween.ObjectPtr.Get()).ToString());
+		Record.ParameterNameIndex = Names.Add(Tween.ParameterName);
+		Record.TimeDomainIndex = Names.Add(Tween.TimeDomain);
+
+		Record.FirstGroup = GroupNames.Num();
+		Record.NumGroups = Tween.Groups.Num();
+
+		for (const FName Group : Tween.Groups)
+		{
+			GroupNames.Add(Names.Add(Group));
+		}
+
+		const int32* NextRecord = Tween.NextTween ? RecordIndices.Find(Tween.NextTween) : nullptr;
+		Record.NextRecord = NextRecord ? *NextRecord : INDEX_NONE;
+
+		Record.Flags =
+			(Tween.bIsRunningInReverse ? FTweenSaveRecord::RunningInReverse : 0) |
+			(Tween.bIsRelativeTween ? FTweenSaveRecord::Relative : 0) |
+			(Tween.bIsPaused ? FTweenSaveRecord::Paused : 0) |
+			(Tween.bIsTimeScaleIndependent ? FTweenSaveRecord::TimeScaleIndependent : 0) |
+			(Tween.bIsSpring ? FTweenSaveRecord::Spring : 0) |
+			(Tween.bIsSpringAsleep ? FTweenSaveRecord::SpringAsleep : 0) |
+			(Tween.bIsCosmetic ? FTweenSaveRecord::Cosmetic : 0) |
+			(Tween.bIsSignificanceThrottled ? FTweenSaveRecord::SignificanceThrottled : 0);
+
+		Record.TweenType = static_cast<uint8>(Tween.TweenType);
+		Record.TargetObjectType = static_cast<uint8>(Tween.TargetObjectType);
+		Record.EaseType = static_cast<uint8>(Tween.EaseType);
+		Record.LoopType = static_cast<uint8>(Tween.LoopType);
+		Record.TickGroup = static_cast<uint8>(Tween.TickGroup);
+		Record.Priority = static_cast<uint8>(Tween.Priority);
+	}
+
+	for (UTween* ActiveTween : ActiveTweens)
+	{
+		if (const int32* RecordIndex = RecordIndices.Find(ActiveTween))
+		{
+			Records[*RecordIndex].Flags |= FTweenSaveRecord::Active;
+		}
+	}
+
+	FMemoryWriter Ar(OutData);
+
+	uint32 Magic = TweenSaveArchive::Magic;
+	int32 Version = static_cast<int32>(ETweenSaveVersion::Latest);
+	int32 RecordSize = sizeof(FTweenSaveRecord);
+	int32 NumRecords = Records.Num();
+
+	Ar << Magic << Version << RecordSize;
+	Ar << Targets.Elements << Names.Elements << GroupNames;
+	Ar << NumRecords;
+
+	Ar.Serialize(Records.GetData(), NumRecords * RecordSize);
+}
+
+bool FTweenSaveArchive::Read(const TArray<uint8>& Data, UObject* Outer, TArray<UTween*>& OutActiveTweens)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	FMemoryReader Ar(Data);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 RecordSize = 0;
+
+	Ar << Magic << Version << RecordSize;
+
+	if (Ar.IsError() || Magic != TweenSaveArchive::Magic || Version != static_cast<int32>(ETweenSaveVersion::Latest) || RecordSize != sizeof(FTweenSaveRecord))
+	{
+		return false;
+	}
+
+	TArray<FString> TargetPaths;
+	TArray<FName> Names;
+	TArray<int32> GroupNames;
+	int32 NumRecords = 0;
+
+	Ar << TargetPaths << Names << GroupNames;
+	Ar << NumRecords;
+
+	if (Ar.IsError() || NumRecords < 0 || Ar.TotalSize() - Ar.Tell() < static_cast<int64>(NumRecords) * RecordSize)
+	{
+		return false;
+	}
+
+	TArray<FTweenSaveRecord> Records;
+	Records.SetNumUninitialized(NumRecords);
+
+	Ar.Serialize(Records.GetData(), NumRecords * RecordSize);
+
+	if (Ar.IsError())
+	{
+		return false;
+	}
+
+	const auto IsValidName = [&Names](int32 Index) { return Names.IsValidIndex(Index); };
+
+	// resolve each target once rather than per tween, nothing is loaded here so the level has to be in already
+	TArray<UObject*> TargetObjects;
+	TargetObjects.Reserve(TargetPaths.Num());
+
+	for (const FString& TargetPath : TargetPaths)
+	{
+		TargetObjects.Add(FSoftObjectPath(TargetPath).ResolveObject());
+	}
+
+	TArray<UTween*> Tweens;
+	Tweens.SetNumZeroed(NumRecords);
+
+	for (int32 Index = 0; Index < NumRecords; ++Index)
+	{
+		const FTweenSaveRecord& Record = Records[Index];
+
+		UObject* Target = TargetObjects.IsValidIndex(Record.TargetIndex) ? TargetObjects[Record.TargetIndex] : nullptr;
+
+		if (!Target || !IsValidName(Record.ParameterNameIndex) || !IsValidName(Record.TimeDomainIndex)
+			|| Record.NumGroups < 0 || Record.FirstGroup < 0 || Record.FirstGroup + Record.NumGroups > GroupNames.Num()
+			|| Record.TargetObjectType > static_cast<uint8>(ETweenTargetObjectType::InstancedStaticMesh)
+			|| Record.TargetObjectType == static_cast<uint8>(ETweenTargetObjectType::CustomAction))
+		{
+			continue;
+		}
+
+		UTween* Tween = NewObject<UTween>(Outer);
+
+		INC_DWORD_STAT(STAT_TweenerAllocations);
+		CSV_CUSTOM_STAT(Tweener, Allocations, 1, ECsvCustomStatOp::Accumulate);
+
+		Tween->ObjectPtr = FWeakObjectPtr(Target);
+		Tween->WorldContextObject = Outer;
+
+		Tween->TargetValue = Record.TargetValue;
+		Tween->SpringVelocity = FVector4f(Record.SpringVelocity);
+
+		Tween->Duration = Record.Duration;
+		Tween->Delay = Record.Delay;
+		Tween->DelayBetweenLoops = Record.DelayBetweenLoops;
+		Tween->ElapsedTime = Record.ElapsedTime;
+		Tween->FixedStepUnits = INDEX_NONE;
+		Tween->TimeScale = Record.TimeScale;
+		Tween->SpringHalfLife = Record.SpringHalfLife;
+
+		Tween->Loops = Record.Loops;
+		Tween->ParameterIndex = Record.ParameterIndex;
+
+		Tween->ParameterName = Names[Record.ParameterNameIndex];
+		Tween->TimeDomain = Names[Record.TimeDomainIndex];
+
+		for (int32 Group = Record.FirstGroup; Group < Record.FirstGroup + Record.NumGroups; ++Group)
+		{
+			if (IsValidName(GroupNames[Group]))
+			{
+				Tween->Groups.Add(Names[GroupNames[Group]]);
+			}
+		}
+
+		Tween->bIsRunningInReverse = (Record.Flags & FTweenSaveRecord::RunningInReverse) != 0;
+		Tween->bIsRelativeTween = (Record.Flags & FTweenSaveRecord::Relative) != 0;
+		Tween->bIsPaused = (Record.Flags & FTweenSaveRecord::Paused) != 0;
+		Tween->bIsTimeScaleIndependent = (Record.Flags & FTweenSaveRecord::TimeScaleIndependent) != 0;
+		Tween->bIsSpring = (Record.Flags & FTweenSaveRecord::Spring) != 0;
+		Tween->bIsSpringAsleep = (Record.Flags & FTweenSaveRecord::SpringAsleep) != 0;
+		Tween->bIsCosmetic = (Record.Flags & FTweenSaveRecord::Cosmetic) != 0;
+		Tween->bIsSignificanceThrottled = (Record.Flags & FTweenSaveRecord::SignificanceThrottled) != 0;
+
+		Tween->TweenType = static_cast<ETweenType>(Record.TweenType);
+		Tween->TargetObjectType = static_cast<ETweenTargetObjectType>(Record.TargetObjectType);
+		Tween->LoopType = static_cast<ELoopType>(Record.LoopType);
+		Tween->TickGroup = static_cast<ETickingGroup>(FMath::Min<uint8>(Record.TickGroup, TG_NewlySpawned - 1));
+		Tween->Priority = static_cast<ETweenPriority>(Record.Priority);
+
+		// after TweenType, which decides whether the values are stored relative to an origin
+		Tween->SetStartValue(Record.StartValue);
+		Tween->SetEndValue(Record.EndValue);
+
+		if (static_cast<EEaseType>(Record.EaseType) == EEaseType::CubicBezier)
+		{
+			Tween->SetCubicBezier(Record.CubicBezier[0], Record.CubicBezier[1], Record.CubicBezier[2], Record.CubicBezier[3]);
+		}
+		else
+		{
+			Tween->EaseType = static_cast<EEaseType>(Record.EaseType);
+		}
+
+		if (Tween->TargetObjectType == ETweenTargetObjectType::Property && !Tween->CacheProperty())
+		{
+			continue;
+		}
+
+		Tweens[Index] = Tween;
+	}
+
+	OutActiveTweens.Reset();
+
+	for (int32 Index = 0; Index < NumRecords; ++Index)
+	{
+		UTween* Tween = Tweens[Index];
+
+		if (!Tween)
+		{
+			continue;
+		}
+
+		const int32 NextRecord = Records[Index].NextRecord;
+		Tween->NextTween = Tweens.IsValidIndex(NextRecord) ? Tweens[NextRecord] : nullptr;
+
+		if (Records[Index].Flags & FTweenSaveRecord::Active)
+		{
+			OutActiveTweens.Add(Tween);
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,274 @@
+#include "TweenSequence.h"
+
+#include "TweenerSubsystem.h"
+#include "TweenerStats.h"
+#include "Engine/World.h"
+
+UTweenSequence* UTweenSequence::CreateSequence(const UObject* WorldContextObject)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	UObject* Outer = WorldContextObject ? WorldContextObject->GetWorld() : (UObject*)GetTransientPackage();
+
+	UTweenSequence* Sequence = NewObject<UTweenSequence>(Outer);
+
+	Sequence->WorldContextObject = WorldContextObject;
+
+	return Sequence;
+}
+
+UTweenSequence* UTweenSequence::Append(UTween* Tween)
+{
+	AddEntry(Tween, EndTime);
+	return this;
+}
+
+UTweenSequence* UTweenSequence::Join(UTween* Tween)
+{
+	AddEntry(Tween, LastStartTime);
+	return this;
+}
+
+UTweenSequence* UTweenSequence::Insert(float Time, UTween* Tween)
+{
+	AddEntry(Tween, FMath::Max(Time, 0.f));
+	return this;
+}
+
+UTweenSequence* UTweenSequence::AppendInterval(float Interval)
+{
+	EndTime += FMath::Max(Interval, 0.f);
+	return this;
+}
+
+UTweenSequence* UTweenSequence::SetTimeScaleIndependent()
+{
+	bIsTimeScaleIndependent = true;
+	return this;
+}
+
+UTweenSequence* UTweenSequence::SetTimeDomain(FName InTimeDomain)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : GetWorld();
+
+	if (UTweenerSubsystem* Subsystem = World ? World->GetSubsystem<UTweenerSubsystem>() : nullptr)
+	{
+		Subsystem->MoveSequence(this, TickGroup, InTimeDomain);
+	}
+	else
+	{
+		TimeDomain = InTimeDomain;
+	}
+	return this;
+}
+
+UTweenSequence* UTweenSequence::SetTickGroup(ETickingGroup InTickGroup)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : GetWorld();
+
+	if (UTweenerSubsystem* Subsystem = World ? World->GetSubsystem<UTweenerSubsystem>() : nullptr)
+	{
+		Subsystem->MoveSequence(this, InTickGroup, TimeDomain);
+	}
+	else
+	{
+		TickGroup = InTickGroup;
+	}
+	return this;
+}
+
+void UTweenSequence::AddEntry(UTween* Tween, float StartTime)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	if (!Tween)
+	{
+		return;
+	}
+
+	FTweenSequenceEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Tween = Tween;
+	Entry.StartTime = StartTime;
+
+	// the whole chain runs in this tween's slot
+	float ChainDuration = 0.f;
+	for (const UTween* Link = Tween; Link; Link = Link->NextTween)
+	{
+		ChainDuration += Link->GetTotalDuration();
+
+		FTweenSequenceLoopSettings& LoopSettings = Entry.LoopSettings.AddDefaulted_GetRef();
+		LoopSettings.Loops = Link->Loops;
+		LoopSettings.Delay = Link->Delay;
+		LoopSettings.LoopType = Link->LoopType;
+		LoopSettings.bIsRunningInReverse = Link->bIsRunningInReverse;
+	}
+
+	LastStartTime = StartTime;
+	EndTime = FMath::Max(EndTime, StartTime + ChainDuration);
+}
+
+bool UTweenSequence::ContainsTween(const UTween* Tween) const
+{
+	return Entries.ContainsByPredicate([Tween](const FTweenSequenceEntry& Entry)
+	{
+		return Entry.Tween == Tween || Entry.ActiveTween == Tween;
+	});
+}
+
+bool UTweenSequence::PrepareForUse()
+{
+	if (Entries.Num() == 0)
+	{
+		return false;
+	}
+
+	// activate in start order so overlapping tweens on one target apply in a predictable order
+	Entries.StableSort([](const FTweenSequenceEntry& A, const FTweenSequenceEntry& B)
+	{
+		return A.StartTime < B.StartTime;
+	});
+
+	for (FTweenSequenceEntry& Entry : Entries)
+	{
+		Entry.ActiveTween = Entry.Tween;
+		Entry.bIsStarted = false;
+		Entry.bIsFinished = false;
+
+		// a previous run counted the loops down, put them back so looped tweens loop again
+		UTween* Link = Entry.Tween;
+		for (int32 Index = 0; Link && Index < Entry.LoopSettings.Num(); ++Index, Link = Link->NextTween)
+		{
+			const FTweenSequenceLoopSettings& LoopSettings = Entry.LoopSettings[Index];
+			Link->Loops = LoopSettings.Loops;
+			Link->Delay = LoopSettings.Delay;
+			Link->LoopType = LoopSettings.LoopType;
+			Link->bIsRunningInReverse = LoopSettings.bIsRunningInReverse;
+		}
+	}
+
+	ElapsedTime = 0.f;
+
+	return true;
+}
+
+bool UTweenSequence::Tick(float DeltaTime, float UnscaledDeltaTime, bool bCompleteSequenceThisStep)
+{
+	ElapsedTime += bIsTimeScaleIndependent ? UnscaledDeltaTime : DeltaTime;
+
+	bool bIsFinished = true;
+
+	for (FTweenSequenceEntry& Entry : Entries)
+	{
+		if (Entry.bIsFinished)
+		{
+			continue;
+		}
+
+		float EntryDeltaTime = DeltaTime;
+		float EntryUnscaledDeltaTime = UnscaledDeltaTime;
+
+		if (!Entry.bIsStarted)
+		{
+			if (!bCompleteSequenceThisStep && Entry.StartTime > ElapsedTime)
+			{
+				bIsFinished = false;
+				continue;
+			}
+
+			Entry.bIsStarted = true;
+
+			// stripped cosmetic tweens skip straight to completion in TickEntry
+			if (!Entry.ActiveTween->ShouldStripAsCosmetic() && !Entry.ActiveTween->PrepareForUse())
+			{
+				Entry.bIsFinished = true;
+				continue;
+			}
+
+			// only the part of the frame after the start time counts towards the new tween
+			EntryDeltaTime = EntryUnscaledDeltaTime = ElapsedTime - Entry.StartTime;
+		}
+
+		TickEntry(Entry, EntryDeltaTime, EntryUnscaledDeltaTime, bCompleteSequenceThisStep);
+
+		bIsFinished &= Entry.bIsFinished;
+	}
+
+	return bIsFinished;
+}
+
+void UTweenSequence::TickEntry(FTweenSequenceEntry& Entry, float DeltaTime, float UnscaledDeltaTime, bool bCompleteTweenThisStep)
+{
+	UTween* Tween = Entry.ActiveTween;
+
+	while (Tween)
+	{
+		if (!Tween->ShouldStripAsCosmetic() && Tween->ObjectPtr.IsValid() && !Tween->Tick(DeltaTime, UnscaledDeltaTime, bCompleteTweenThisStep))
+		{
+			break;
+		}
+
+		Tween->BroadcastComplete();
+
+		UTween* NextTween = Tween->NextTween;
+		Tween = NextTween && (NextTween->ShouldStripAsCosmetic() || NextTween->PrepareForUse()) ? NextTween : nullptr;
+
+		// as with the subsystem, the next link starts moving on the following frame
+		if (!bCompleteTweenThisStep)
+		{
+			break;
+		}
+	}
+
+	Entry.ActiveTween = Tween;
+	Entry.bIsFinished = Tween == nullptr;
+}
+
+void UTweenSequence::Activate()
+{
+	// sequences made without a world context live in the transient package, which has no world of its own
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : GetWorld();
+
+	if (!World)
+	{
+		return;
+	}
+
+	if (UTweenerSubsystem* Subsystem = World->GetSubsystem<UTweenerSubsystem>())
+	{
+		Subsystem->StartSequence(this);
+	}
+}
+
+bool UTweenSequence::Stop(bool bBringToCompletion)
+{
+	UWorld* World = GetWorld();
+
+	if (!World)
+	{
+		return false;
+	}
+
+	if (UTweenerSubsystem* Subsystem = World->GetSubsystem<UTweenerSubsystem>())
+	{
+		return Subsystem->StopSequence(this, bBringToCompletion);
+	}
+
+	return false;
+}
+
+bool UTweenSequence::IsActive() const
+{
+	UWorld* World = GetWorld();
+
+	if (!World)
+	{
+		return false;
+	}
+
+	if (UTweenerSubsystem* Subsystem = World->GetSubsystem<UTweenerSubsystem>())
+	{
+		return Subsystem->IsSequenceActive(this);
+	}
+
+	return false;
+}
@@ -0,0 +1,232 @@
+#include "TweenSignificance.h"
+
+#include "Blueprint/UserWidget.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/Widget.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	int32 GTweenerThrottleByDefault = 0;
+	FAutoConsoleVariableRef CVarTweenerThrottleByDefault(
+		TEXT("tweener.Significance.ThrottleByDefault"),
+		GTweenerThrottleByDefault,
+		TEXT("New tweens start with significance throttling on, as if SetSignificanceThrottled had been called."),
+		ECVF_Default);
+
+	float GTweenerEvaluationInterval = 0.25f;
+	FAutoConsoleVariableRef CVarTweenerEvaluationInterval(
+		TEXT("tweener.Significance.EvaluationInterval"),
+		GTweenerEvaluationInterval,
+		TEXT("Seconds between significance checks of a throttled tween."),
+		ECVF_Scalability);
+
+	float GTweenerReducedDistance = 3000.f;
+	FAutoConsoleVariableRef CVarTweenerReducedDistance(
+		TEXT("tweener.Significance.ReducedDistance"),
+		GTweenerReducedDistance,
+		TEXT("Distance from the closest view beyond which throttled tweens are updated at the reduced rate. 0 disables."),
+		ECVF_Scalability);
+
+	float GTweenerFrozenDistance = 10000.f;
+	FAutoConsoleVariableRef CVarTweenerFrozenDistance(
+		TEXT("tweener.Significance.FrozenDistance"),
+		GTweenerFrozenDistance,
+		TEXT("Distance from the closest view beyond which throttled tweens are frozen. 0 disables."),
+		ECVF_Scalability);
+
+	float GTweenerReducedUpdateInterval = 0.1f;
+	FAutoConsoleVariableRef CVarTweenerReducedUpdateInterval(
+		TEXT("tweener.Significance.ReducedUpdateInterval"),
+		GTweenerReducedUpdateInterval,
+		TEXT("Seconds between updates of tweens at the reduced rate."),
+		ECVF_Scalability);
+
+	float GTweenerNotRenderedTolerance = 0.5f;
+	FAutoConsoleVariableRef CVarTweenerNotRenderedTolerance(
+		TEXT("tweener.Significance.NotRenderedTolerance"),
+		GTweenerNotRenderedTolerance,
+		TEXT("Seconds a target can go without being rendered before its throttled tweens are frozen."),
+		ECVF_Scalability);
+}
+
+bool FTweenSignificance::IsThrottledByDefault()
+{
+	return GTweenerThrottleByDefault != 0;
+}
+
+bool FTweenSignificance::ShouldUpdate(UTween& Tween, const UWorld& World, const FTweenSignificanceOverride& Override, float& DeltaTime, float& UnscaledDeltaTime)
+{
+	Tween.PendingDeltaTime += DeltaTime;
+	Tween.PendingUnscaledDeltaTime += UnscaledDeltaTime;
+	Tween.SignificanceCheckCountdown -= UnscaledDeltaTime;
+
+	if (Tween.SignificanceCheckCountdown <= 0.f)
+	{
+		Tween.Significance = Evaluate(Tween, World, Override);
+		Tween.SignificanceCheckCountdown = GTweenerEvaluationInterval;
+	}
+
+	const float PendingTime = Tween.bIsTimeScaleIndependent ? Tween.PendingUnscaledDeltaTime : Tween.PendingDeltaTime;
+
+	bool bShouldUpdate = Tween.Significance == ETweenSignificance::Full
+		|| (Tween.Significance == ETweenSignificance::Reduced && PendingTime >= GTweenerReducedUpdateInterval);
+
+	// the end of a loop is never held back, so loop and completion delegates fire when they would have
+	bShouldUpdate |= PendingTime >= Tween.Duration - Tween.ElapsedTime;
+
+	if (!bShouldUpdate)
+	{
+		return false;
+	}
+
+	// catch up on everything skipped in one step
+	DeltaTime = Tween.PendingDeltaTime;
+	UnscaledDeltaTime = Tween.PendingUnscaledDeltaTime;
+
+	Tween.PendingDeltaTime = 0.f;
+	Tween.PendingUnscaledDeltaTime = 0.f;
+
+	return true;
+}
+
+ETweenSignificance FTweenSignificance::Evaluate(const UTween& Tween, const UWorld& World, const FTweenSignificanceOverride& Override)
+{
+	ETweenSignificance Significance = ETweenSignificance::Full;
+
+	if (Override.IsBound() && Override.Execute(Tween, Significance))
+	{
+		return Significance;
+	}
+
+	UObject* Object = Tween.ObjectPtr.Get();
+
+	switch (Tween.TargetObjectType)
+	{
+	case ETweenTargetObjectType::SceneComponent:
+	case ETweenTargetObjectType::InstancedStaticMesh:
+		if (const USceneComponent* Component = Cast<USceneComponent>(Object))
+		{
+			return EvaluateSceneComponent(*Component, World);
+		}
+		break;
+	case ETweenTargetObjectType::Widget:
+		if (const UWidget* Widget = Cast<UWidget>(Object))
+		{
+			return EvaluateWidget(*Widget);
+		}
+		break;
+	default:
+		break;
+	}
+
+	// nothing to judge materials, properties or custom actions by
+	return ETweenSignificance::Full;
+}
+
+ETweenSignificance FTweenSignificance::EvaluateSceneComponent(const USceneComponent& Component, const UWorld& World)
+{
+	// nothing is rendered on a dedicated server, but what it moves may still matter to gameplay
+	if (World.GetNetMode() == NM_DedicatedServer)
+	{
+		return ETweenSignificance::Full;
+	}
+
+	bool bWasRecentlyRendered = true;
+
+	if (const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(&Component))
+	{
+		bWasRecentlyRendered = Primitive->WasRecentlyRendered(GTweenerNotRenderedTolerance);
+	}
+	else if (const AActor* Owner = Component.GetOwner())
+	{
+		bWasRecentlyRendered = Owner->WasRecentlyRendered(GTweenerNotRenderedTolerance);
+	}
+
+	if (!bWasRecentlyRendered)
+	{
+		return ETweenSignificance::Frozen;
+	}
+
+	UpdateViewLocations(World);
+
+	if (ViewLocations.Num() == 0)
+	{
+		return ETweenSignificance::Full;
+	}
+
+	const FVector Location = Component.Bounds.Origin;
+
+	float ClosestDistanceSquared = TNumericLimits<float>::Max();
+
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		ClosestDistanceSquared = FMath::Min(ClosestDistanceSquared, static_cast<float>(FVector::DistSquared(Location, ViewLocation)));
+	}
+
+	if (GTweenerFrozenDistance > 0.f && ClosestDistanceSquared > FMath::Square(GTweenerFrozenDistance))
+	{
+		return ETweenSignificance::Frozen;
+	}
+
+	if (GTweenerReducedDistance > 0.f && ClosestDistanceSquared > FMath::Square(GTweenerReducedDistance))
+	{
+		return ETweenSignificance::Reduced;
+	}
+
+	return ETweenSignificance::Full;
+}
+
+ETweenSignificance FTweenSignificance::EvaluateWidget(const UWidget& Widget)
+{
+	// a widget that was never constructed isn't on screen
+	if (!Widget.GetCachedWidget().IsValid())
+	{
+		return ETweenSignificance::Frozen;
+	}
+
+	// hidden if it, or anything it is nested in, is collapsed, hidden or fully transparent
+	for (const UWidget* Current = &Widget; Current; )
+	{
+		if (!Current->IsRendered())
+		{
+			return ETweenSignificance::Frozen;
+		}
+
+		if (const UWidget* Parent = Current->GetParent())
+		{
+			Current = Parent;
+		}
+		else
+		{
+			// the root of a user widget's tree carries on from the user widget itself
+			Current = Current->GetTypedOuter<UUserWidget>();
+		}
+	}
+
+	return ETweenSignificance::Full;
+}
+
+void FTweenSignificance::UpdateViewLocations(const UWorld& World)
+{
+	if (ViewLocationsFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	ViewLocationsFrame = GFrameCounter;
+	ViewLocations.Reset();
+
+	for (FConstPlayerControllerIterator Iterator = World.GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+
+		if (PlayerController && PlayerController->IsLocalController() && PlayerController->PlayerCameraManager)
+		{
+			ViewLocations.Add(PlayerController->PlayerCameraManager->GetCameraLocation());
+		}
+	}
+}
@@ -0,0 +1,345 @@
+#include "TweenerConsole.h"
+
+#include "Tween.h"
+#include "TweenerSubsystem.h"
+#include "Algo/Count.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTweenerConsole, Log, All);
+
+namespace
+{
+	float GTweenerTimeScale = 1.f;
+	FAutoConsoleVariableRef CVarTweenerTimeScale(
+		TEXT("tweener.TimeScale"),
+		GTweenerTimeScale,
+		TEXT("Multiplies the delta time of every tween, on top of its time domain and its own time scale."),
+		ECVF_Default);
+
+	uint32 GTweenerDisabledTargetTypes = 0;
+	FString GTweenerDisabledTargetTypeNames;
+	FAutoConsoleVariableRef CVarTweenerDisabledTargetTypes(
+		TEXT("tweener.DisabledTargetTypes"),
+		GTweenerDisabledTargetTypeNames,
+		TEXT("Comma separated target types whose tweens are held where they are, e.g. Widget,Material. ")
+		TEXT("One of SceneComponent, Material, Widget, Property, CustomAction or InstancedStaticMesh."),
+		FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*)
+		{
+			const UEnum* TargetTypeEnum = StaticEnum<ETweenTargetObjectType>();
+
+			TArray<FString> Names;
+			GTweenerDisabledTargetTypeNames.ParseIntoArray(Names, TEXT(","));
+
+			GTweenerDisabledTargetTypes = 0;
+
+			for (FString& Name : Names)
+			{
+				Name.TrimStartAndEndInline();
+
+				const int64 TargetType = TargetTypeEnum->GetValueByNameString(Name);
+
+				if (TargetType == INDEX_NONE)
+				{
+					UE_LOG(LogTweenerConsole, Warning, TEXT("tweener.DisabledTargetTypes: %s isn't a target type"), *Name);
+					continue;
+				}
+
+				GTweenerDisabledTargetTypes |= 1u << static_cast<uint32>(TargetType);
+			}
+		}),
+		ECVF_Default);
+
+	int32 GTweenerTrackCost = 0;
+	FAutoConsoleVariableRef CVarTweenerTrackCost(
+		TEXT("tweener.TrackCost"),
+		GTweenerTrackCost,
+		TEXT("Times the update of every tween so tweener.top can sort by cost. Adds two clock reads per tween per update."),
+		ECVF_Default);
+
+	UTweenerSubsystem* FindSubsystem(UWorld* World, FOutputDevice& Ar)
+	{
+		UTweenerSubsystem* Subsystem = World ? World->GetSubsystem<UTweenerSubsystem>() : nullptr;
+
+		if (!Subsystem)
+		{
+			Ar.Log(TEXT("There is no tweener subsystem in this world"));
+		}
+
+		return Subsystem;
+	}
+
+	/** Filters match a target type (Widget), a class the target is or derives from (Image) or part of the target's name */
+	bool MatchesFilter(const UTween& Tween, const FString& Filter)
+	{
+		if (Filter.IsEmpty())
+		{
+			return true;
+		}
+
+		if (StaticEnum<ETweenTargetObjectType>()->GetNameStringByValue(static_cast<int64>(Tween.TargetObjectType)).Equals(Filter, ESearchCase::IgnoreCase))
+		{
+			return true;
+		}
+
+		const UObject* Target = Tween.ObjectPtr.Get();
+
+		if (!Target)
+		{
+			return false;
+		}
+
+		for (const UClass* Class = Target->GetClass(); Class; Class = Class->GetSuperClass())
+		{
+			if (Class->GetName().Equals(Filter, ESearchCase::IgnoreCase))
+			{
+				return true;
+			}
+		}
+
+		return Target->GetName().Contains(Filter);
+	}
+
+	TArray<UTween*> GetMatchingTweens(const UTweenerSubsystem& Subsystem, const FString& Filter)
+	{
+		TArray<UTween*> Tweens;
+		Subsystem.GetActiveTweens(Tweens);
+
+		Tweens.RemoveAll([&Filter](const UTween* Tween) { return !MatchesFilter(*Tween, Filter); });
+
+		return Tweens;
+	}
+
+	const TCHAR* GetStateName(const UTween& Tween)
+	{
+		if (Tween.bIsPaused)
+		{
+			return TEXT("paused");
+		}
+
+		if (GTweenerDisabledTargetTypes & (1u << static_cast<uint32>(Tween.TargetObjectType)))
+		{
+			return TEXT("disabled");
+		}
+
+		if (Tween.bIsSpring)
+		{
+			return Tween.bIsSpringAsleep ? TEXT("spring asleep") : TEXT("spring");
+		}
+
+		return Tween.ElapsedTime < 0.f ? TEXT("delayed") : TEXT("running");
+	}
+
+	FString DescribeTween(const UTween& Tween, double WorldTimeSeconds)
+	{
+		FString Description = FString::Printf(TEXT("%s %s %.2f/%.2fs, %s, loops %d, %s, running %.1fs"),
+			*StaticEnum<ETweenType>()->GetNameStringByValue(static_cast<int64>(Tween.TweenType)),
+			Tween.bIsSpring ? TEXT("Spring") : *StaticEnum<EEaseType>()->GetNameStringByValue(static_cast<int64>(Tween.EaseType)),
+			Tween.ElapsedTime, Tween.Duration, GetStateName(Tween), Tween.Loops, *Tween.TimeDomain.ToString(),
+			WorldTimeSeconds - Tween.StartTimeSeconds);
+
+		if (Tween.TickCycles > 0)
+		{
+			Description += FString::Printf(TEXT(", %.3f ms updating"), FPlatformTime::ToMilliseconds64(Tween.TickCycles));
+		}
+
+		if (Tween.Groups.Num() > 0)
+		{
+			TArray<FString> GroupNames;
+
+			for (const FName& Group : Tween.Groups)
+			{
+				GroupNames.Add(Group.ToString());
+			}
+
+			Description += FString::Printf(TEXT(", groups %s"), *FString::Join(GroupNames, TEXT(",")));
+		}
+
+		return Description;
+	}
+
+	FString GetTargetName(const UTween& Tween)
+	{
+		const UObject* Target = Tween.ObjectPtr.Get();
+		return Target ? FString::Printf(TEXT("%s (%s)"), *Target->GetPathName(), *Target->GetClass()->GetName()) : FString(TEXT("<gone>"));
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdTweenerDump(
+		TEXT("tweener.dump"),
+		TEXT("Lists the active tweens by target type and target. tweener.dump [target type, class or name]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const UTweenerSubsystem* Subsystem = FindSubsystem(World, Ar);
+
+			if (!Subsystem)
+			{
+				return;
+			}
+
+			TArray<UTween*> Tweens = GetMatchingTweens(*Subsystem, Args.Num() > 0 ? Args[0] : FString());
+
+			TMap<const UTween*, FString> TargetNames;
+
+			for (const UTween* Tween : Tweens)
+			{
+				TargetNames.Add(Tween, GetTargetName(*Tween));
+			}
+
+			Tweens.Sort([&TargetNames](const UTween& A, const UTween& B)
+			{
+				return A.TargetObjectType != B.TargetObjectType ? A.TargetObjectType < B.TargetObjectType : TargetNames[&A] < TargetNames[&B];
+			});
+
+			const UEnum* TargetTypeEnum = StaticEnum<ETweenTargetObjectType>();
+			const double WorldTimeSeconds = World->GetTimeSeconds();
+
+			Ar.Logf(TEXT("%d active tweens in %s"), Tweens.Num(), *World->GetName());
+
+			for (int32 Index = 0; Index < Tweens.Num(); ++Index)
+			{
+				const UTween& Tween = *Tweens[Index];
+				const bool bIsNewTargetType = Index == 0 || Tweens[Index - 1]->TargetObjectType != Tween.TargetObjectType;
+
+				if (bIsNewTargetType)
+				{
+					const int32 NumOfType = Algo::CountIf(Tweens, [&Tween](const UTween* Other) { return Other->TargetObjectType == Tween.TargetObjectType; });
+
+					Ar.Logf(TEXT("%s: %d"), *TargetTypeEnum->GetNameStringByValue(static_cast<int64>(Tween.TargetObjectType)), NumOfType);
+				}
+
+				if (bIsNewTargetType || TargetNames[Tweens[Index - 1]] != TargetNames[&Tween])
+				{
+					Ar.Logf(TEXT("  %s"), *TargetNames[&Tween]);
+				}
+
+				Ar.Logf(TEXT("    %s"), *DescribeTween(Tween, WorldTimeSeconds));
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdTweenerTop(
+		TEXT("tweener.top"),
+		TEXT("Lists the tweens that have been running longest, or spent longest updating. tweener.top [count] [time|cost]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const UTweenerSubsystem* Subsystem = FindSubsystem(World, Ar);
+
+			if (!Subsystem)
+			{
+				return;
+			}
+
+			const int32 Count = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 10;
+			const bool bByCost = Args.Num() > 1 && Args[1].Equals(TEXT("cost"), ESearchCase::IgnoreCase);
+
+			if (bByCost && !GTweenerTrackCost)
+			{
+				Ar.Log(TEXT("tweener.TrackCost is off, costs only cover the time it was on"));
+			}
+
+			TArray<UTween*> Tweens;
+			Subsystem->GetActiveTweens(Tweens);
+
+			Tweens.Sort([bByCost](const UTween& A, const UTween& B)
+			{
+				return bByCost ? A.TickCycles > B.TickCycles : A.StartTimeSeconds < B.StartTimeSeconds;
+			});
+
+			const double WorldTimeSeconds = World->GetTimeSeconds();
+
+			Ar.Logf(TEXT("Top %d of %d active tweens by %s"), FMath::Min(Count, Tweens.Num()), Tweens.Num(), bByCost ? TEXT("cost") : TEXT("time running"));
+
+			for (int32 Index = 0; Index < FMath::Min(Count, Tweens.Num()); ++Index)
+			{
+				Ar.Logf(TEXT("%3d %s: %s"), Index + 1, *GetTargetName(*Tweens[Index]), *DescribeTween(*Tweens[Index], WorldTimeSeconds));
+			}
+		}));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdTweenerComplete(
+		TEXT("tweener.complete"),
+		TEXT("Brings the matching tweens, and the tweens chained after them, to completion. tweener.complete <target type, class or name>"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			UTweenerSubsystem* Subsystem = FindSubsystem(World, Ar);
+
+			if (!Subsystem)
+			{
+				return;
+			}
+
+			if (Args.Num() == 0)
+			{
+				Ar.Log(TEXT("tweener.complete <target type, class or name>"));
+				return;
+			}
+
+			int32 NumCompleted = 0;
+
+			// completion delegates can stop or start tweens, StopTween skips any that are no longer active
+			for (UTween* Tween : GetMatchingTweens(*Subsystem, Args[0]))
+			{
+				NumCompleted += Subsystem->StopTween(Tween, true, true) ? 1 : 0;
+			}
+
+			Ar.Logf(TEXT("Completed %d tweens"), NumCompleted);
+		}));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdTweenerPause(
+		TEXT("tweener.pause"),
+		TEXT("Pauses, or with 0 resumes, the matching tweens. tweener.pause <target type, class or name> [1|0]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const UTweenerSubsystem* Subsystem = FindSubsystem(World, Ar);
+
+			if (!Subsystem)
+			{
+				return;
+			}
+
+			if (Args.Num() == 0)
+			{
+				Ar.Log(TEXT("tweener.pause <target type, class or name> [1|0]"));
+				return;
+			}
+
+			const bool bIsPaused = Args.Num() < 2 || FCString::Atoi(*Args[1]) != 0;
+
+			const TArray<UTween*> Tweens = GetMatchingTweens(*Subsystem, Args[0]);
+
+			for (UTween* Tween : Tweens)
+			{
+				Tween->bIsPaused = bIsPaused;
+			}
+
+			Ar.Logf(TEXT("%s %d tweens"), bIsPaused ? TEXT("Paused") : TEXT("Resumed"), Tweens.Num());
+		}));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdTweenerMemReport(
+		TEXT("tweener.memreport"),
+		TEXT("Memory used by the tweens in this world, by target type, state and chain length."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			if (const UTweenerSubsystem* Subsystem = FindSubsystem(World, Ar))
+			{
+				Subsystem->DumpMemoryReport(Ar);
+			}
+		}));
+}
+
+namespace TweenerConsole
+{
+	float GetGlobalTimeScale()
+	{
+		return FMath::Max(GTweenerTimeScale, 0.f);
+	}
+
+	uint32 GetDisabledTargetTypes()
+	{
+		return GTweenerDisabledTargetTypes;
+	}
+
+	bool IsTrackingCost()
+	{
+		return GTweenerTrackCost != 0;
+	}
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Console variables for inspecting and A/B testing tweens on a running build. The commands, tweener.dump, tweener.top,
+ * tweener.complete, tweener.pause and tweener.memreport, are registered in TweenerConsole.cpp.
+ */
+namespace TweenerConsole
+{
+	/** tweener.TimeScale, multiplies every time domain */
+	float GetGlobalTimeScale();
+
+	/** tweener.DisabledTargetTypes as a mask of 1 << ETweenTargetObjectType, tweens of these types are held where they are */
+	uint32 GetDisabledTargetTypes();
+
+	/** tweener.TrackCost, times each tween's update for tweener.top */
+	bool IsTrackingCost();
+}
@@ -0,0 +1,26 @@
+#include "TweenerStats.h"
+
+DEFINE_STAT(STAT_TweenerTick);
+DEFINE_STAT(STAT_TweenerEvaluate);
+DEFINE_STAT(STAT_TweenerApplySceneComponent);
+DEFINE_STAT(STAT_TweenerApplyInstancedStaticMesh);
+DEFINE_STAT(STAT_TweenerApplyMaterial);
+DEFINE_STAT(STAT_TweenerApplyWidget);
+DEFINE_STAT(STAT_TweenerApplyProperty);
+DEFINE_STAT(STAT_TweenerApplyCustomAction);
+DEFINE_STAT(STAT_TweenerInstanceBatchFlush);
+DEFINE_STAT(STAT_TweenerEventDispatch);
+
+DEFINE_STAT(STAT_TweenerActiveTweens);
+DEFINE_STAT(STAT_TweenerPausedTweens);
+DEFINE_STAT(STAT_TweenerStartedTweens);
+DEFINE_STAT(STAT_TweenerCompletedTweens);
+DEFINE_STAT(STAT_TweenerAllocations);
+
+DEFINE_STAT(STAT_TweenerBudgetDeferredTweens);
+DEFINE_STAT(STAT_TweenerBudgetOverrunFrames);
+DEFINE_STAT(STAT_TweenerBudgetUsedMs);
+
+CSV_DEFINE_CATEGORY(Tweener, true);
+
+LLM_DEFINE_TAG(Tweener);
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/LowLevelMemTracker.h"
+
+DECLARE_STATS_GROUP(TEXT("Tweener"), STATGROUP_Tweener, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick"), STAT_TweenerTick, STATGROUP_Tweener, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Evaluate"), STAT_TweenerEvaluate, STATGROUP_Tweener, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Scene Component"), STAT_TweenerApplySceneComponent, STATGROUP_Tweener, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Instanced Static Mesh"), STAT_TweenerApplyInstancedStaticMesh, STATGROUP_Tweener, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Material"), STAT_TweenerApplyMaterial, STATGROUP_Tweener, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Widget"), STAT_TweenerApplyWidget, STATGROUP_Tweener, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Property"), STAT_TweenerApplyProperty, STATGROUP_Tweener, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Custom Action"), STAT_TweenerApplyCustomAction, STATGROUP_Tweener, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Instance Batch Flush"), STAT_TweenerInstanceBatchFlush, STATGROUP_Tweener, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Event Dispatch"), STAT_TweenerEventDispatch, STATGROUP_Tweener, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Tweens"), STAT_TweenerActiveTweens, STATGROUP_Tweener, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Paused Tweens"), STAT_TweenerPausedTweens, STATGROUP_Tweener, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Started Tweens"), STAT_TweenerStartedTweens, STATGROUP_Tweener, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Completed Tweens"), STAT_TweenerCompletedTweens, STATGROUP_Tweener, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Tween Allocations"), STAT_TweenerAllocations, STATGROUP_Tweener, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Budget Deferred Tweens"), STAT_TweenerBudgetDeferredTweens, STATGROUP_Tweener, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Budget Overrun Frames"), STAT_TweenerBudgetOverrunFrames, STATGROUP_Tweener, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Budget Used (ms)"), STAT_TweenerBudgetUsedMs, STATGROUP_Tweener, );
+
+/** Per frame totals for csvprofiler captures, alongside the stats above */
+CSV_DECLARE_CATEGORY_EXTERN(Tweener);
+
+/** Low level memory tracker tag for everything tweens allocate, see -llm and tweener.memreport */
+LLM_DECLARE_TAG(Tweener);
@@ -1,187 +1,1256 @@
 #include "TweenerSubsystem.h"
+#include "TweenInstanceBatch.h"
+#include "TweenerConsole.h"
+#include "TweenSaveArchive.h"
+#include "TweenerStats.h"
+#include "TweenerTrace.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Blueprint/UserWidget.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Misc/App.h"
+#include "HAL/IConsoleManager.h"
 
+namespace
+{
+	float GTweenerBudgetMilliseconds = 0.f;
+	FAutoConsoleVariableRef CVarTweenerBudgetMilliseconds(
+		TEXT("tweener.Budget.Milliseconds"),
+		GTweenerBudgetMilliseconds,
+		TEXT("Time per frame low priority tweens may be updated in before they are deferred to a later frame. 0 disables the budget."),
+		ECVF_Scalability);
+}
+
+
+void FTweenerTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		Subsystem->TickTweens(TickGroup);
+	}
+}
+
+FString FTweenerTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("UTweenerSubsystem[%d]"), static_cast<int32>(TickGroup));
+}
+
+bool UTweenerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE || WorldType == EWorldType::GamePreview;
+}
+
+void UTweenerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	Super::Initialize(Collection);
+
+	TickGroups.SetNum(TG_NewlySpawned);
+
+	for (int32 Group = 0; Group < TG_NewlySpawned; ++Group)
+	{
+		FTweenerTickFunction* TickFunction = new FTweenerTickFunction();
+		TickFunction->Subsystem = this;
+		TickFunction->TickGroup = static_cast<ETickingGroup>(Group);
+		TickFunction->bCanEverTick = true;
+		TickFunction->bTickEvenWhenPaused = true;
+		TickFunction->bStartWithTickEnabled = false;
+		TickFunction->bAllowTickOnDedicatedServer = true;
+
+		TickFunctions.Add(TickFunction);
+	}
+
+	FindOrAddTimeDomain(TweenTimeDomain::Gameplay);
+	FindOrAddTimeDomain(TweenTimeDomain::UI, true);
+	FindOrAddTimeDomain(TweenTimeDomain::Cinematic);
+}
+
+void UTweenerSubsystem::Deinitialize()
+{
+	for (FTweenerTickFunction& TickFunction : TickFunctions)
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+
+	TickFunctions.Empty();
+
+	// the world is going away, its tweens go with it without being completed
+	TickGroups.Empty();
+	GroupMembers.Empty();
+
+	Super::Deinitialize();
+}
+
+FTweenerTickGroup& UTweenerSubsystem::GetTickGroup(ETickingGroup Group)
+{
+	return TickGroups[Group < TickGroups.Num() ? Group : UTween::DefaultTickGroup];
+}
+
+FTweenerTweenList& UTweenerSubsystem::GetTweenList(ETickingGroup Group, FName TimeDomain)
+{
+	const int32 DomainIndex = FindOrAddTimeDomain(TimeDomain);
+
+	FTweenerTickGroup& TickGroup = GetTickGroup(Group);
+
+	if (!TickGroup.TimeDomains.IsValidIndex(DomainIndex))
+	{
+		TickGroup.TimeDomains.SetNum(DomainIndex + 1);
+	}
+
+	return TickGroup.TimeDomains[DomainIndex];
+}
+
+const FTweenerTweenList* UTweenerSubsystem::FindTweenList(ETickingGroup Group, FName TimeDomain) const
+{
+	const int32* DomainIndex = TimeDomainIndices.Find(TimeDomain);
+
+	if (!DomainIndex)
+	{
+		return nullptr;
+	}
+
+	const FTweenerTickGroup& TickGroup = TickGroups[Group < TickGroups.Num() ? Group : UTween::DefaultTickGroup];
+
+	return TickGroup.TimeDomains.IsValidIndex(*DomainIndex) ? &TickGroup.TimeDomains[*DomainIndex] : nullptr;
+}
+
+int32 UTweenerSubsystem::FindOrAddTimeDomain(FName TimeDomain, bool bUsesRealTime)
+{
+	if (const int32* DomainIndex = TimeDomainIndices.Find(TimeDomain))
+	{
+		return *DomainIndex;
+	}
+
+	FTweenTimeDomainState& State = TimeDomains.AddDefaulted_GetRef();
+	State.Name = TimeDomain;
+	State.bUsesRealTime = bUsesRealTime;
+
+	return TimeDomainIndices.Add(TimeDomain, TimeDomains.Num() - 1);
+}
+
+void UTweenerSubsystem::RegisterTimeDomain(FName TimeDomain, bool bUsesRealTime)
+{
+	TimeDomains[FindOrAddTimeDomain(TimeDomain, bUsesRealTime)].bUsesRealTime = bUsesRealTime;
+}
+
+void UTweenerSubsystem::SetTimeDomainScale(FName TimeDomain, float TimeScale)
+{
+	TimeDomains[FindOrAddTimeDomain(TimeDomain)].TimeScale = FMath::Max(TimeScale, 0.f);
+}
+
+float UTweenerSubsystem::GetTimeDomainScale(FName TimeDomain) const
+{
+	const int32* DomainIndex = TimeDomainIndices.Find(TimeDomain);
+
+	return DomainIndex ? TimeDomains[*DomainIndex].TimeScale : 1.f;
+}
+
+void UTweenerSubsystem::MoveTween(UTween* Tween, ETickingGroup TickGroup, FName TimeDomain)
+{
+	if (!Tween || (Tween->TickGroup == TickGroup && Tween->TimeDomain == TimeDomain))
+	{
+		return;
+	}
+
+	TArray<UTween*>& OldTweens = GetTweenList(Tween->TickGroup, Tween->TimeDomain).ActiveTweens;
+	const int32 Index = OldTweens.Find(Tween);
+
+	// nulled rather than removed, a delegate may be moving the tween while its list is being walked
+	if (Index != INDEX_NONE)
+	{
+		OldTweens[Index] = nullptr;
+	}
+
+	// a stripped tween waits in its tick group for its completion to fire
+	const bool bWasStripped = Tween->TickGroup != TickGroup && GetTickGroup(Tween->TickGroup).PendingStrippedTweens.Remove(Tween) > 0;
+
+	if (Tween->TimeDomain != TimeDomain)
+	{
+		// the step count is worked out again from ElapsedTime if the new domain is fixed step
+		Tween->FixedStepUnits = INDEX_NONE;
+	}
+
+	Tween->TickGroup = TickGroup;
+	Tween->TimeDomain = TimeDomain;
+
+	if (Index != INDEX_NONE)
+	{
+		GetTweenList(TickGroup, TimeDomain).ActiveTweens.Add(Tween);
+		WakeTickGroup(TickGroup);
+	}
+	else if (bWasStripped)
+	{
+		QueueStrippedTween(Tween);
+	}
+}
+
+void UTweenerSubsystem::MoveSequence(UTweenSequence* Sequence, ETickingGroup TickGroup, FName TimeDomain)
+{
+	if (!Sequence || (Sequence->TickGroup == TickGroup && Sequence->TimeDomain == TimeDomain))
+	{
+		return;
+	}
+
+	const bool bWasActive = GetTweenList(Sequence->TickGroup, Sequence->TimeDomain).ActiveSequences.Remove(Sequence) > 0;
+
+	Sequence->TickGroup = TickGroup;
+	Sequence->TimeDomain = TimeDomain;
+
+	if (bWasActive)
+	{
+		GetTweenList(TickGroup, TimeDomain).ActiveSequences.Add(Sequence);
+		WakeTickGroup(TickGroup);
+	}
+}
+
+void UTweenerSubsystem::SetTimeDomainPaused(FName TimeDomain, bool bIsPaused)
+{
+	TimeDomains[FindOrAddTimeDomain(TimeDomain)].bIsPaused = bIsPaused;
+}
+
+bool UTweenerSubsystem::IsTimeDomainPaused(FName TimeDomain) const
+{
+	const int32* DomainIndex = TimeDomainIndices.Find(TimeDomain);
+
+	return DomainIndex && TimeDomains[*DomainIndex].bIsPaused;
+}
+
+void UTweenerSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	CastChecked<UTweenerSubsystem>(InThis)->RollbackBuffer.AddReferencedObjects(Collector);
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+void UTweenerSubsystem::InitializeRollback(int32 NumFrames, int32 MaxTweensPerFrame)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	RollbackBuffer.Initialize(NumFrames, MaxTweensPerFrame);
+}
+
+bool UTweenerSubsystem::CaptureSnapshot(int32 Frame)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	int32 NumActiveTweens = 0;
+
+	for (const FTweenerTickGroup& TickGroup : TickGroups)
+	{
+		for (const FTweenerTweenList& TweenList : TickGroup.TimeDomains)
+		{
+			for (const UTween* Tween : TweenList.ActiveTweens)
+			{
+				NumActiveTweens += Tween && !Tween->bIsPendingRemoval ? 1 : 0;
+			}
+		}
+	}
+
+	const TArrayView<FTweenSnapshotRecord> Records = RollbackBuffer.BeginCapture(Frame, NumActiveTweens);
+
+	if (Records.Num() != NumActiveTweens)
+	{
+		return false;
+	}
+
+	int32 RecordIndex = 0;
+
+	for (int32 Group = 0; Group < TickGroups.Num(); ++Group)
+	{
+		for (int32 DomainIndex = 0; DomainIndex < TickGroups[Group].TimeDomains.Num(); ++DomainIndex)
+		{
+			for (UTween* Tween : TickGroups[Group].TimeDomains[DomainIndex].ActiveTweens)
+			{
+				if (Tween && !Tween->bIsPendingRemoval)
+				{
+					Records[RecordIndex++].Capture(*Tween, static_cast<uint8>(Group), static_cast<uint16>(DomainIndex));
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+bool UTweenerSubsystem::RestoreSnapshot(int32 Frame)
+{
+	TArrayView<const FTweenSnapshotRecord> Records;
+
+	if (!RollbackBuffer.Find(Frame, Records))
+	{
+		return false;
+	}
+
+	// rebuilt in captured order, Reset keeps the lists' allocations
+	for (FTweenerTickGroup& TickGroup : TickGroups)
+	{
+		for (FTweenerTweenList& TweenList : TickGroup.TimeDomains)
+		{
+			TweenList.ActiveTweens.Reset();
+			TweenList.RoundRobinOffset = 0;
+		}
+	}
+
+	for (TPair<FName, FTweenerGroupMembers>& Pair : GroupMembers)
+	{
+		Pair.Value.Tweens.Reset();
+	}
+
+	for (const FTweenSnapshotRecord& Record : Records)
+	{
+		Record.Restore();
+
+		TickGroups[Record.TickGroup].TimeDomains[Record.DomainIndex].ActiveTweens.Add(Record.Tween);
+		AddToGroupIndex(Record.Tween);
+	}
+
+	for (int32 Group = 0; Group < TickGroups.Num(); ++Group)
+	{
+		if (!TickGroups[Group].IsEmpty())
+		{
+			WakeTickGroup(static_cast<ETickingGroup>(Group));
+		}
+	}
+
+	return true;
+}
+
+void UTweenerSubsystem::SaveActiveTweens(TArray<uint8>& OutData) const
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	TArray<UTween*> ActiveTweens;
+	GetActiveTweens(ActiveTweens);
+
+	FTweenSaveArchive::Write(ActiveTweens, OutData);
+}
+
+int32 UTweenerSubsystem::LoadActiveTweens(const TArray<uint8>& Data)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	TArray<UTween*> Tweens;
+
+	if (!FTweenSaveArchive::Read(Data, GetWorld(), Tweens))
+	{
+		return INDEX_NONE;
+	}
+
+	// the saved state is used as is, so the tweens go straight into their lists without PrepareForUse
+	for (UTween* Tween : Tweens)
+	{
+		if (Tween->ShouldStripAsCosmetic())
+		{
+			QueueStrippedTween(Tween);
+			continue;
+		}
+
+		AddStartedTween(Tween, false);
+	}
+
+	return Tweens.Num();
+}
+
+void UTweenerSubsystem::DumpMemoryReport(FOutputDevice& Ar) const
+{
+	enum class EState : uint8
+	{
+		Running,
+		Delayed,
+		Paused,
+		Sleeping,
+		PendingRemoval,
+		Queued,
+
+		Count
+	};
+
+	static const TCHAR* const StateNames[] = { TEXT("Running"), TEXT("Delayed"), TEXT("Paused"), TEXT("Sleeping"), TEXT("Removing"), TEXT("Queued") };
+
+	struct FTargetTypeMemory
+	{
+		int32 NumTweens = 0;
+		SIZE_T Bytes = 0;
+		int32 NumByState[static_cast<int32>(EState::Count)] = {};
+	};
+
+	const UEnum* TargetTypeEnum = StaticEnum<ETweenTargetObjectType>();
+
+	TArray<FTargetTypeMemory> ByTargetType;
+	ByTargetType.SetNum(TargetTypeEnum->NumEnums() - 1);
+
+	/** Number of active tweens with 0, 1, 2, 3 and 4 or more tweens chained after them */
+	int32 NumByChainLength[5] = {};
+
+	TSet<const UTween*> CountedTweens;
+	TSet<const FTweenCubicBezierCurve*> CubicBezierCurves;
+
+	const auto AddTween = [&](UTween& Tween, EState State)
+	{
+		FTargetTypeMemory& Memory = ByTargetType[FMath::Min(static_cast<int32>(Tween.TargetObjectType), ByTargetType.Num() - 1)];
+
+		++Memory.NumTweens;
+		Memory.Bytes += Tween.GetClass()->GetStructureSize() + Tween.GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+		++Memory.NumByState[static_cast<int32>(State)];
+
+		if (Tween.CubicBezierCurve.IsValid())
+		{
+			CubicBezierCurves.Add(Tween.CubicBezierCurve.Get());
+		}
+	};
+
+	SIZE_T ListBytes = TickGroups.GetAllocatedSize();
+	SIZE_T SequenceBytes = 0;
+	int32 NumSequences = 0;
+
+	for (const FTweenerTickGroup& TickGroup : TickGroups)
+	{
+		ListBytes += TickGroup.TimeDomains.GetAllocatedSize();
+
+		for (const FTweenerTweenList& TweenList : TickGroup.TimeDomains)
+		{
+			ListBytes += TweenList.ActiveTweens.GetAllocatedSize() + TweenList.ActiveSequences.GetAllocatedSize();
+
+			for (UTween* Tween : TweenList.ActiveTweens)
+			{
+				if (!Tween || CountedTweens.Contains(Tween))
+				{
+					continue;
+				}
+
+				CountedTweens.Add(Tween);
+
+				EState State = EState::Running;
+
+				if (Tween->bIsPendingRemoval)
+				{
+					State = EState::PendingRemoval;
+				}
+				else if (Tween->bIsPaused)
+				{
+					State = EState::Paused;
+				}
+				else if (Tween->bIsSpring && Tween->bIsSpringAsleep)
+				{
+					State = EState::Sleeping;
+				}
+				else if (Tween->ElapsedTime < 0.f)
+				{
+					State = EState::Delayed;
+				}
+
+				AddTween(*Tween, State);
+
+				int32 ChainLength = 0;
+
+				// chained tweens are allocated up front and wait here until the tween before them completes
+				for (UTween* Next = Tween->NextTween; Next && !CountedTweens.Contains(Next); Next = Next->NextTween)
+				{
+					CountedTweens.Add(Next);
+					AddTween(*Next, EState::Queued);
+					++ChainLength;
+				}
+
+				++NumByChainLength[FMath::Min(ChainLength, static_cast<int32>(UE_ARRAY_COUNT(NumByChainLength)) - 1)];
+			}
+
+			for (UTweenSequence* Sequence : TweenList.ActiveSequences)
+			{
+				if (Sequence)
+				{
+					++NumSequences;
+					SequenceBytes += Sequence->GetClass()->GetStructureSize() + Sequence->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+				}
+			}
+		}
+	}
+
+	SIZE_T GroupBytes = GroupMembers.GetAllocatedSize();
+
+	for (const TPair<FName, FTweenerGroupMembers>& Group : GroupMembers)
+	{
+		GroupBytes += Group.Value.Tweens.GetAllocatedSize();
+	}
+
+	const SIZE_T TimeDomainBytes = TimeDomains.GetAllocatedSize() + TimeDomainIndices.GetAllocatedSize();
+	const SIZE_T TickFunctionBytes = TickFunctions.GetAllocatedSize() + TickFunctions.Num() * sizeof(FTweenerTickFunction);
+	const SIZE_T RollbackBytes = RollbackBuffer.GetAllocatedSize();
+	const SIZE_T InstanceBatchBytes = InstanceBatch.GetAllocatedSize();
+	const SIZE_T CubicBezierBytes = CubicBezierCurves.Num() * sizeof(FTweenCubicBezierCurve);
+
+	const auto ToKiB = [](SIZE_T Bytes) { return Bytes / 1024.0; };
+
+	Ar.Logf(TEXT("Tweener memory in %s"), *GetWorld()->GetName());
+
+	Ar.Logf(TEXT("%-20s %8s %10s %8s %8s %8s %8s %8s %8s"), TEXT("Target type"), TEXT("Tweens"), TEXT("KiB"),
+		StateNames[0], StateNames[1], StateNames[2], StateNames[3], StateNames[4], StateNames[5]);
+
+	SIZE_T TweenBytes = 0;
+	int32 NumTweens = 0;
+
+	for (int32 TargetTypeIndex = 0; TargetTypeIndex < ByTargetType.Num(); ++TargetTypeIndex)
+	{
+		const FTargetTypeMemory& Memory = ByTargetType[TargetTypeIndex];
+
+		Ar.Logf(TEXT("%-20s %8d %10.1f %8d %8d %8d %8d %8d %8d"), *TargetTypeEnum->GetNameStringByIndex(TargetTypeIndex), Memory.NumTweens, ToKiB(Memory.Bytes),
+			Memory.NumByState[0], Memory.NumByState[1], Memory.NumByState[2], Memory.NumByState[3], Memory.NumByState[4], Memory.NumByState[5]);
+
+		TweenBytes += Memory.Bytes;
+		NumTweens += Memory.NumTweens;
+	}
+
+	Ar.Logf(TEXT("Tweens chained after each active tween: 0: %d, 1: %d, 2: %d, 3: %d, 4+: %d"),
+		NumByChainLength[0], NumByChainLength[1], NumByChainLength[2], NumByChainLength[3], NumByChainLength[4]);
+
+	Ar.Logf(TEXT("Tweens %d: %.1f KiB"), NumTweens, ToKiB(TweenBytes));
+	Ar.Logf(TEXT("Sequences %d: %.1f KiB"), NumSequences, ToKiB(SequenceBytes));
+	Ar.Logf(TEXT("Cubic bezier curves %d: %.1f KiB, shared between tweens and worlds"), CubicBezierCurves.Num(), ToKiB(CubicBezierBytes));
+	Ar.Logf(TEXT("Active lists: %.1f KiB"), ToKiB(ListBytes));
+	Ar.Logf(TEXT("Group index: %.1f KiB"), ToKiB(GroupBytes));
+	Ar.Logf(TEXT("Time domains: %.1f KiB"), ToKiB(TimeDomainBytes));
+	Ar.Logf(TEXT("Tick functions: %.1f KiB"), ToKiB(TickFunctionBytes));
+	Ar.Logf(TEXT("Rollback buffer: %.1f KiB"), ToKiB(RollbackBytes));
+	Ar.Logf(TEXT("Instance batch: %.1f KiB, shared between worlds"), ToKiB(InstanceBatchBytes));
+	Ar.Logf(TEXT("Total: %.1f KiB"), ToKiB(TweenBytes + SequenceBytes + CubicBezierBytes + ListBytes + GroupBytes + TimeDomainBytes + TickFunctionBytes
+		+ RollbackBytes + InstanceBatchBytes));
+}
+
+void UTweenerSubsystem::SetTimeDomainFixedStep(FName TimeDomain, int32 StepsPerSecond, int32 MaxSubSteps, bool bIsManuallyStepped)
+{
+	FTweenTimeDomainState& State = TimeDomains[FindOrAddTimeDomain(TimeDomain)];
+	State.FixedStepRate = FMath::Max(StepsPerSecond, 0);
+	State.MaxSubSteps = FMath::Max(MaxSubSteps, 1);
+	State.bIsManuallyStepped = bIsManuallyStepped;
+	State.FixedStepAccumulator = 0.0;
+	State.PendingManualSteps = 0;
+}
+
+void UTweenerSubsystem::AdvanceTimeDomain(FName TimeDomain, int32 Steps)
+{
+	FTweenTimeDomainState& State = TimeDomains[FindOrAddTimeDomain(TimeDomain)];
+
+	if (State.FixedStepRate > 0 && State.bIsManuallyStepped)
+	{
+		State.PendingManualSteps += FMath::Max(Steps, 0);
+	}
+}
+
+void UTweenerSubsystem::WakeTickGroup(ETickingGroup Group)
+{
+	UWorld* World = GetWorld();
+
+	FTweenerTickFunction& TickFunction = TickFunctions[Group < TickFunctions.Num() ? Group : UTween::DefaultTickGroup];
+
+	// registered on first use, the persistent level doesn't exist yet when the subsystem is initialized
+	if (!TickFunction.IsTickFunctionRegistered() && World->PersistentLevel)
+	{
+		TickFunction.RegisterTickFunction(World->PersistentLevel);
+	}
+
+	if (TickFunction.IsTickFunctionRegistered() && !TickFunction.IsTickFunctionEnabled())
+	{
+		// the group hasn't been keeping time while it slept
+		GetTickGroup(Group).LastTickGameTimeSeconds = World->GetTimeSeconds();
+
+		TickFunction.SetTickFunctionEnable(true);
+	}
+}
+
+void UTweenerSubsystem::BeginFrame()
+{
+	FrameCounter = GFrameCounter;
+
+	// the budget is shared by every tick group in the frame
+	BudgetUsedSeconds = 0.0;
+	bIsBudgetOverrun = false;
+
+	// fixed step domains work out their steps once a frame so every tick group advances by the same amount
+	const float WorldDeltaTime = GetWorld()->GetDeltaSeconds();
+	const float RealDeltaTime = FApp::GetDeltaTime();
+
+	for (FTweenTimeDomainState& TimeDomain : TimeDomains)
+	{
+		TimeDomain.StepsThisFrame = 0;
+
+		if (TimeDomain.FixedStepRate <= 0 || TimeDomain.bIsPaused)
+		{
+			continue;
+		}
+
+		if (TimeDomain.bIsManuallyStepped)
+		{
+			TimeDomain.StepsThisFrame = TimeDomain.PendingManualSteps;
+			TimeDomain.PendingManualSteps = 0;
+			continue;
+		}
+
+		const double StepSeconds = 1.0 / TimeDomain.FixedStepRate;
+
+		TimeDomain.FixedStepAccumulator += (TimeDomain.bUsesRealTime ? RealDeltaTime : WorldDeltaTime) * TimeDomain.TimeScale * TweenerConsole::GetGlobalTimeScale();
+
+		const int32 Steps = FMath::FloorToInt(TimeDomain.FixedStepAccumulator / StepSeconds);
+
+		TimeDomain.StepsThisFrame = FMath::Min(Steps, TimeDomain.MaxSubSteps);
+
+		// time beyond the sub-step limit is dropped rather than carried into an ever growing backlog
+		TimeDomain.FixedStepAccumulator = TimeDomain.StepsThisFrame < Steps ? 0.0 : TimeDomain.FixedStepAccumulator - Steps * StepSeconds;
+	}
+}
+
+void UTweenerSubsystem::TickTweens(ETickingGroup Group)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	SCOPE_CYCLE_COUNTER(STAT_TweenerTick);
+	CSV_SCOPED_TIMING_STAT(Tweener, Tick);
+
+	if (FrameCounter != GFrameCounter)
+	{
+		BeginFrame();
+	}
+
+	FTweenerTickGroup& TickGroup = GetTickGroup(Group);
+
+	FTweenerTickContext Context;
+	Context.StartSeconds = FPlatformTime::Seconds();
+	Context.BudgetSeconds = GTweenerBudgetMilliseconds * 0.001;
+	Context.RemainingBudgetSeconds = Context.BudgetSeconds - BudgetUsedSeconds;
+	Context.bIsOutOfBudget = Context.BudgetSeconds > 0.0 && Context.RemainingBudgetSeconds <= 0.0;
+
+	// each world keeps its own clock, so PIE instances and travelling don't disturb each other
+	const float CurrentWorldTime = GetWorld()->GetTimeSeconds();
+	const float WorldDeltaTime = CurrentWorldTime - TickGroup.LastTickGameTimeSeconds;
+	const float RealDeltaTime = FApp::GetDeltaTime();
+	const float GlobalTimeScale = TweenerConsole::GetGlobalTimeScale();
+
+	TickGroup.LastTickGameTimeSeconds = CurrentWorldTime;
+
+	// chains started by these completions queue their stripped links for the following tick
+	if (TickGroup.PendingStrippedTweens.Num() > 0)
+	{
+		TArray<UTween*> StrippedTweens = MoveTemp(TickGroup.PendingStrippedTweens);
+
+		for (UTween* Tween : StrippedTweens)
+		{
+			CompleteStrippedTween(Tween);
+		}
+	}
+
+	// completing tweens can start tweens in new time domains, so the lists are looked up by index rather than held on to
+	for (int32 DomainIndex = 0; DomainIndex < TickGroup.TimeDomains.Num(); ++DomainIndex)
+	{
+		const FTweenTimeDomainState& TimeDomain = TimeDomains[DomainIndex];
+
+		if (TimeDomain.bIsPaused)
+		{
+			continue;
+		}
+
+		if (TimeDomain.FixedStepRate > 0)
+		{
+			const float StepSeconds = 1.f / TimeDomain.FixedStepRate;
+			const int32 Steps = TimeDomain.StepsThisFrame;
+
+			for (int32 Step = 0; Step < Steps; ++Step)
+			{
+				TickTweenList(TickGroup, DomainIndex, StepSeconds, StepSeconds, true, Context);
+			}
+
+			continue;
+		}
+
+		const float DeltaTime = (TimeDomain.bUsesRealTime ? RealDeltaTime : WorldDeltaTime) * TimeDomain.TimeScale * GlobalTimeScale;
+		const float UnscaledDeltaTime = RealDeltaTime * TimeDomain.TimeScale * GlobalTimeScale;
+
+		TickTweenList(TickGroup, DomainIndex, DeltaTime, UnscaledDeltaTime, false, Context);
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TweenerInstanceBatchFlush);
+		InstanceBatch.Flush();
+	}
+
+	const double TickSeconds = FPlatformTime::Seconds() - Context.StartSeconds;
+	BudgetUsedSeconds += TickSeconds;
+
+	if (Context.BudgetSeconds > 0.0 && BudgetUsedSeconds > Context.BudgetSeconds && !bIsBudgetOverrun)
+	{
+		bIsBudgetOverrun = true;
+		INC_DWORD_STAT(STAT_TweenerBudgetOverrunFrames);
+	}
+
+	INC_DWORD_STAT_BY(STAT_TweenerBudgetDeferredTweens, Context.NumDeferredTweens);
+	INC_FLOAT_STAT_BY(STAT_TweenerBudgetUsedMs, static_cast<float>(TickSeconds * 1000.0));
+	CSV_CUSTOM_STAT(Tweener, BudgetUsedMs, static_cast<float>(TickSeconds * 1000.0), ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(Tweener, BudgetDeferredTweens, Context.NumDeferredTweens, ECsvCustomStatOp::Accumulate);
+
+#if STATS || CSV_PROFILER
+	int32 NumActiveTweens = 0;
+	int32 NumPausedTweens = 0;
+
+	for (const FTweenerTweenList& TweenList : TickGroup.TimeDomains)
+	{
+		for (const UTween* Tween : TweenList.ActiveTweens)
+		{
+			NumActiveTweens += Tween ? 1 : 0;
+			NumPausedTweens += Tween && Tween->bIsPaused ? 1 : 0;
+		}
+	}
+
+	// summed over the tick groups that run this frame
+	INC_DWORD_STAT_BY(STAT_TweenerActiveTweens, NumActiveTweens);
+	INC_DWORD_STAT_BY(STAT_TweenerPausedTweens, NumPausedTweens);
+	CSV_CUSTOM_STAT(Tweener, ActiveTweens, NumActiveTweens, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(Tweener, PausedTweens, NumPausedTweens, ECsvCustomStatOp::Accumulate);
+#endif
+
+	// nothing left to do in this group, stop paying for its tick until something is added
+	if (TickGroup.IsEmpty())
+	{
+		TickFunctions[Group].SetTickFunctionEnable(false);
+	}
+}
+
+void UTweenerSubsystem::TickTweenList(FTweenerTickGroup& TickGroup, int32 DomainIndex, float DeltaTime, float UnscaledDeltaTime, bool bIsFixedStep, FTweenerTickContext& Context)
+{
+	const int32 NumTweens = TickGroup.TimeDomains[DomainIndex].ActiveTweens.Num();
+
+	// walk backwards, starting from the first tween the budget deferred last frame so deferred tweens take turns.
+	// Finished tweens are nulled and compacted afterwards, and tweens started while walking wait for the next pass
+	const int32 FirstIndex = NumTweens - 1 - (NumTweens > 0 ? TickGroup.TimeDomains[DomainIndex].RoundRobinOffset % NumTweens : 0);
+	int32 FirstDeferredStep = INDEX_NONE;
+	bool bHasFinishedTweens = false;
+
+	const uint32 DisabledTargetTypes = TweenerConsole::GetDisabledTargetTypes();
+	const bool bIsTrackingCost = TweenerConsole::IsTrackingCost();
+
+	for (int32 Step = 0; Step < NumTweens; ++Step)
+	{
+		TArray<UTween*>& ActiveTweens = TickGroup.TimeDomains[DomainIndex].ActiveTweens;
+
+		const int32 Index = FirstIndex - Step >= 0 ? FirstIndex - Step : FirstIndex - Step + NumTweens;
+
+		// a completion delegate may have stopped tweens out from under us
+		if (!ActiveTweens.IsValidIndex(Index))
+		{
+			continue;
+		}
+
+		UTween *Tween = ActiveTweens[Index];
+
+		if(Tween == nullptr || Tween->bIsPendingRemoval)
+		{
+			ActiveTweens[Index] = nullptr;
+			bHasFinishedTweens = true;
+			continue;
+		}
+		
+		// settled springs sleep in the list until they are retargeted or stopped
+		if (Tween->bIsPaused || Tween->bIsSpringAsleep)
+		{
+			continue;
+		}
+
+		// held where they are by tweener.DisabledTargetTypes
+		if (DisabledTargetTypes & (1u << static_cast<uint32>(Tween->TargetObjectType)))
+		{
+			continue;
+		}
+
+		float TweenDeltaTime = DeltaTime * Tween->TimeScale;
+		float TweenUnscaledDeltaTime = UnscaledDeltaTime * Tween->TimeScale;
+
+		// fixed step tweens must see exactly the same steps on every run, so they are never deferred or throttled
+		if (!bIsFixedStep)
+		{
+			if (Tween->Priority == ETweenPriority::Low && Context.BudgetSeconds > 0.0)
+			{
+				Context.bIsOutOfBudget = Context.bIsOutOfBudget || FPlatformTime::Seconds() - Context.StartSeconds > Context.RemainingBudgetSeconds;
+
+				if (Context.bIsOutOfBudget)
+				{
+					Tween->PendingDeltaTime += TweenDeltaTime;
+					Tween->PendingUnscaledDeltaTime += TweenUnscaledDeltaTime;
+
+					if (FirstDeferredStep == INDEX_NONE)
+					{
+						FirstDeferredStep = Step;
+					}
+
+					++Context.NumDeferredTweens;
+					continue;
+				}
+			}
+
+			if (Tween->bIsSignificanceThrottled && !Tween->bIsSpring)
+			{
+				if (!Significance.ShouldUpdate(*Tween, *GetWorld(), SignificanceOverride, TweenDeltaTime, TweenUnscaledDeltaTime))
+				{
+					continue;
+				}
+			}
+			else if (Tween->PendingDeltaTime > 0.f || Tween->PendingUnscaledDeltaTime > 0.f)
+			{
+				TweenDeltaTime += Tween->PendingDeltaTime;
+				TweenUnscaledDeltaTime += Tween->PendingUnscaledDeltaTime;
+
+				Tween->PendingDeltaTime = 0.f;
+				Tween->PendingUnscaledDeltaTime = 0.f;
+			}
+		}
+
+		bool bIsComplete = !Tween->ObjectPtr.IsValid();
+
+		if (!bIsComplete)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_TweenerEvaluate);
+
+			const uint64 StartCycles = bIsTrackingCost ? FPlatformTime::Cycles64() : 0;
+
+			bIsComplete = bIsFixedStep ? Tween->TickFixedStep(TimeDomains[DomainIndex].FixedStepRate) : Tween->Tick(TweenDeltaTime, TweenUnscaledDeltaTime);
+
+			if (bIsTrackingCost)
+			{
+				Tween->TickCycles += FPlatformTime::Cycles64() - StartCycles;
+			}
+		}
+
+		// a spring that has settled can still be retargeted, so it isn't complete until it is stopped
+		if (bIsComplete && Tween->bIsSpring && Tween->ObjectPtr.IsValid())
+		{
+			continue;
+		}
+
+		if (bIsComplete)
+		{
+			TickGroup.TimeDomains[DomainIndex].ActiveTweens[Index] = nullptr;
+			bHasFinishedTweens = true;
+
+			RemoveFromGroupIndex(Tween);
+
+			INC_DWORD_STAT(STAT_TweenerCompletedTweens);
+			CSV_CUSTOM_STAT(Tweener, CompletedTweens, 1, ECsvCustomStatOp::Accumulate);
+			TRACE_TWEEN_COMPLETE(*Tween);
+
+			{
+				SCOPE_CYCLE_COUNTER(STAT_TweenerEventDispatch);
+				Tween->BroadcastComplete();
+			}
+
+			//// handle nextTween if we have a chain
+			if (Tween->NextTween != nullptr)
+			{
+				TRACE_TWEEN_CHAIN_ADVANCE(*Tween, *Tween->NextTween);
+				StartNewTween(Tween->NextTween);
+			}
+		}
+	}
+
+	FTweenerTweenList& TweenList = TickGroup.TimeDomains[DomainIndex];
+
+	TweenList.RoundRobinOffset = FirstDeferredStep != INDEX_NONE ? (TweenList.RoundRobinOffset + FirstDeferredStep) % NumTweens : 0;
+
+	if (bHasFinishedTweens)
+	{
+		TweenList.ActiveTweens.RemoveAll([](const UTween* Tween) { return Tween == nullptr; });
+	}
+
+	for (int32 Index = TickGroup.TimeDomains[DomainIndex].ActiveSequences.Num() - 1; Index >= 0; --Index)
+	{
+		TArray<UTweenSequence*>& ActiveSequences = TickGroup.TimeDomains[DomainIndex].ActiveSequences;
+
+		UTweenSequence* Sequence = ActiveSequences[Index];
+
+		if (Sequence == nullptr)
+		{
+			ActiveSequences.RemoveAt(Index);
+			continue;
+		}
+
+		if (Sequence->bIsPaused)
+		{
+			continue;
+		}
+
+		if (Sequence->Tick(DeltaTime, UnscaledDeltaTime))
+		{
+			ActiveSequences.RemoveAt(Index);
+
+			Sequence->Complete.Broadcast();
+			Sequence->CompleteDelegate.Broadcast();
+		}
+	}
+}
+
+bool UTweenerSubsystem::StopTween(UTween* Tween, bool bBringToCompletion, bool bIncludeChain)
+{
+	UTween* TweenItr = Tween;
+
+	bool bFoundActive = false;
+
+	while (TweenItr)
+	{
+		const bool bWasActive = (GetTweenList(TweenItr->TickGroup, TweenItr->TimeDomain).ActiveTweens.Remove(TweenItr) > 0 && !TweenItr->bIsPendingRemoval)
+			|| GetTickGroup(TweenItr->TickGroup).PendingStrippedTweens.Remove(TweenItr) > 0;
+
+		if (bWasActive)
+		{
+			RemoveFromGroupIndex(TweenItr);
+			TRACE_TWEEN_STOP(*TweenItr, bBringToCompletion);
+		}
+		
+		if (bFoundActive || bWasActive)
+		{
+			if (bBringToCompletion)
+			{
+				if (TweenItr->ObjectPtr.IsValid() && !TweenItr->ShouldStripAsCosmetic())
+				{
+					if(!bWasActive)
+					{
+						TweenItr->PrepareForUse();
+					}
+
+					TweenItr->Tick(0.f, 0.f, true);
+				}
+
+				TweenItr->BroadcastComplete();
+			}
+
+			//Every linked tween after the active tween will need to be Completed
+			bFoundActive = true;
+		}
+
+		TweenItr = bIncludeChain ? TweenItr->NextTween : nullptr;
+	}
+
+	return bFoundActive;
+}
+
+bool UTweenerSubsystem::StopTweenForObject(UObject *Object, bool bBringToCompletion)
+{
+	const FWeakObjectPtr ObjectPtr = FWeakObjectPtr(Object);
+
+	const bool bComplete = ObjectPtr.IsValid() && bBringToCompletion;
+
+	bool bDidRemoveTween = false;
+
+	for (FTweenerTickGroup& TickGroup : TickGroups)
+	{
+		for (FTweenerTweenList& TweenList : TickGroup.TimeDomains)
+		{
+			TArray<UTween*>& ActiveTweens = TweenList.ActiveTweens;
+
+			for (int32 Index = ActiveTweens.Num() - 1; Index >= 0; --Index)
+			{
+				UTween* Tween = ActiveTweens[Index];
+
+				// a completion delegate stopping tweens mid tick sees the finished ones already nulled
+				if(Tween && Tween->ObjectPtr == ObjectPtr)
+				{
+					if (Tween->bIsPendingRemoval)
+					{
+						ActiveTweens.RemoveAt(Index);
+						continue;
+					}
+
+					RemoveFromGroupIndex(Tween);
+					TRACE_TWEEN_STOP(*Tween, bComplete);
+
+					if (bComplete)
+					{
+						Tween->Tick(0.f, 0.f, true);
+
+						Tween->BroadcastComplete();
+					}
+
+					ActiveTweens.RemoveAt(Index);
+					bDidRemoveTween = true;
+				}
+			}
+		}
+	}
+
+	return bDidRemoveTween;
+}
+
+void UTweenerSubsystem::StopAllTweens(bool bBringToCompletion)
+{
+	for (FTweenerTickGroup& TickGroup : TickGroups)
+	{
+		for (FTweenerTweenList& TweenList : TickGroup.TimeDomains)
+		{
+			for (auto ActiveTween : TweenList.ActiveTweens)
+			{
+				if (!ActiveTween || ActiveTween->bIsPendingRemoval)
+				{
+					continue;
+				}
+
+				TRACE_TWEEN_STOP(*ActiveTween, bBringToCompletion);
+
+				if (bBringToCompletion && ActiveTween->ObjectPtr.IsValid())
+				{
+					ActiveTween->Tick(0.f, 0.f, true);
+
+					ActiveTween->BroadcastComplete();
+				}
+			}
+
+			if(bBringToCompletion)
+			{
+				for (UTweenSequence* Sequence : TweenList.ActiveSequences)
+				{
+					Sequence->Tick(0.f, 0.f, true);
+
+					Sequence->Complete.Broadcast();
+					Sequence->CompleteDelegate.Broadcast();
+				}
+			}
+
+			TweenList.ActiveTweens.Empty();
+			TweenList.ActiveSequences.Empty();
+		}
+
+		if (bBringToCompletion)
+		{
+			for (UTween* StrippedTween : TickGroup.PendingStrippedTweens)
+			{
+				StrippedTween->BroadcastComplete();
+			}
+		}
+
+		TickGroup.PendingStrippedTweens.Empty();
+	}
+
+	GroupMembers.Empty();
+}
 
-// Called every frame
-void UTweenerSubsystem::Tick(float DeltaTime)
+UTweenSequence* UTweenerSubsystem::StartSequence(UTweenSequence* Sequence)
 {
-	float UnscaledDeltaTime = DeltaTime;
-	
-	if(UWorld* TickableGameObjectWorld = GetTickableGameObjectWorld())
+	LLM_SCOPE_BYTAG(Tweener);
+
+	if (Sequence && Sequence->PrepareForUse())
 	{
-		if (UWorld* World = TickableGameObjectWorld->GetWorld())
-		{
-			const float CurrentWorldTime = World->GetTimeSeconds();
+		GetTweenList(Sequence->TickGroup, Sequence->TimeDomain).ActiveSequences.AddUnique(Sequence);
+		WakeTickGroup(Sequence->TickGroup);
+		return Sequence;
+	}
 
-			DeltaTime = CurrentWorldTime - LastTickGameTimeSeconds;
+	return nullptr;
+}
 
-			LastTickGameTimeSeconds = CurrentWorldTime;
-		}
+bool UTweenerSubsystem::StopSequence(UTweenSequence* Sequence, bool bBringToCompletion)
+{
+	if (!Sequence || GetTweenList(Sequence->TickGroup, Sequence->TimeDomain).ActiveSequences.Remove(Sequence) == 0)
+	{
+		return false;
 	}
 
-	
-	// loop backwards so we can remove completed tweens
-	for (int32 Index = ActiveTweens.Num() -1 ; Index >= 0; --Index)
+	if (bBringToCompletion)
 	{
-		UTween *Tween = ActiveTweens[Index];
+		Sequence->Tick(0.f, 0.f, true);
 
-		if(Tween == nullptr)
-		{
-			ActiveTweens.RemoveAt(Index);
-			continue;
-		}
-		
-		if (Tween->bIsPaused)
-		{
-			continue;
-		}
+		Sequence->Complete.Broadcast();
+		Sequence->CompleteDelegate.Broadcast();
+	}
 
-		if (!Tween->ObjectPtr.IsValid() || Tween->Tick(DeltaTime, UnscaledDeltaTime))
-		{
-			ActiveTweens.RemoveAt(Index);
+	return true;
+}
 
-			Tween->Complete.Broadcast();
-			Tween->CompleteDelegate.Broadcast();
+bool UTweenerSubsystem::IsSequenceActive(const UTweenSequence* Sequence) const
+{
+	const FTweenerTweenList* TweenList = Sequence ? FindTweenList(Sequence->TickGroup, Sequence->TimeDomain) : nullptr;
 
-			//// handle nextTween if we have a chain
-			if (Tween->NextTween != nullptr)
+	return TweenList && TweenList->ActiveSequences.Contains(Sequence);
+}
+
+void UTweenerSubsystem::SetAllTweenPauseState(bool bIsPaused)
+{
+	for (FTweenerTickGroup& TickGroup : TickGroups)
+	{
+		for (FTweenerTweenList& TweenList : TickGroup.TimeDomains)
+		{
+			for (auto ActiveTween : TweenList.ActiveTweens)
 			{
-				if(Tween->NextTween->PrepareForUse())
+				if (ActiveTween)
 				{
-					ActiveTweens.Add(Tween->NextTween);
+					ActiveTween->bIsPaused = bIsPaused;
 				}
 			}
+
+			for (auto ActiveSequence : TweenList.ActiveSequences)
+			{
+				ActiveSequence->bIsPaused = bIsPaused;
+			}
 		}
 	}
 }
 
-ETickableTickType UTweenerSubsystem::GetTickableTickType() const
+void UTweenerSubsystem::GetActiveTweens(TArray<UTween*>& OutTweens) const
 {
-	return ETickableTickType::Always;
+	OutTweens.Reset();
+
+	for (const FTweenerTickGroup& TickGroup : TickGroups)
+	{
+		for (const FTweenerTweenList& TweenList : TickGroup.TimeDomains)
+		{
+			for (UTween* Tween : TweenList.ActiveTweens)
+			{
+				if (Tween && !Tween->bIsPendingRemoval)
+				{
+					OutTweens.Add(Tween);
+				}
+			}
+		}
+	}
 }
 
-TStatId UTweenerSubsystem::GetStatId() const
+bool UTweenerSubsystem::IsTweenActive(const UTween* Tween) const
 {
-	RETURN_QUICK_DECLARE_CYCLE_STAT(UTweenerSubsystem, STATGROUP_Tickables);
+	const FTweenerTweenList* TweenList = Tween ? FindTweenList(Tween->TickGroup, Tween->TimeDomain) : nullptr;
+
+	if (TweenList && !Tween->bIsPendingRemoval && TweenList->ActiveTweens.Contains(Tween))
+	{
+		return true;
+	}
+
+	// a stripped tween counts as running until its completion fires
+	return Tween && TickGroups[Tween->TickGroup < TickGroups.Num() ? Tween->TickGroup : UTween::DefaultTickGroup].PendingStrippedTweens.Contains(Tween);
 }
 
-bool UTweenerSubsystem::StopTween(UTween* Tween, bool bBringToCompletion, bool bIncludeChain)
+bool UTweenerSubsystem::ObjectHasActiveTweens(const UObject* Object) const
 {
-	UTween* TweenItr = Tween;
-
-	bool bFoundActive = false;
+	const FWeakObjectPtr ObjectPtr = FWeakObjectPtr(Object);
 
-	while (TweenItr)
+	for (const FTweenerTickGroup& TickGroup : TickGroups)
 	{
-		const bool bWasActive = ActiveTweens.Remove(TweenItr) > 0;
-		
-		if (bFoundActive || bWasActive)
+		for (const FTweenerTweenList& TweenList : TickGroup.TimeDomains)
 		{
-			if (bBringToCompletion)
+			for (auto ActiveTween : TweenList.ActiveTweens)
 			{
-				if (TweenItr->ObjectPtr.IsValid())
+				if (ActiveTween && ActiveTween->ObjectPtr == ObjectPtr && !ActiveTween->bIsPendingRemoval)
 				{
-					if(!bWasActive)
-					{
-						TweenItr->PrepareForUse();
-					}
-
-					TweenItr->Tick(0.f, 0.f, true);
+					return true;
 				}
-
-				TweenItr->Complete.Broadcast();
-				TweenItr->CompleteDelegate.Broadcast();
 			}
-
-			//Every linked tween after the active tween will need to be Completed
-			bFoundActive = true;
 		}
-
-		TweenItr = bIncludeChain ? TweenItr->NextTween : nullptr;
 	}
 
-	return bFoundActive;
+	return false;
 }
 
-bool UTweenerSubsystem::StopTweenForObject(UObject *Object, bool bBringToCompletion)
+
+void UTweenerSubsystem::SetGroupPauseState(FName Group, bool bIsPaused)
 {
-	const FWeakObjectPtr ObjectPtr = FWeakObjectPtr(Object);
+	if (FTweenerGroupMembers* Members = GroupMembers.Find(Group))
+	{
+		for (UTween* Tween : Members->Tweens)
+		{
+			Tween->bIsPaused = bIsPaused;
+		}
+	}
+}
 
-	const bool bComplete = ObjectPtr.IsValid() && bBringToCompletion;
+int32 UTweenerSubsystem::StopGroup(FName Group, bool bBringToCompletion)
+{
+	FTweenerGroupMembers Members;
 
-	bool bDidRemoveTween = false;
-	
-	for (int32 Index = ActiveTweens.Num() - 1; Index >= 0; --Index)
+	if (!GroupMembers.RemoveAndCopyValue(Group, Members))
+	{
+		return 0;
+	}
+
+	for (UTween* Tween : Members.Tweens)
 	{
-		UTween* Tween = ActiveTweens[Index];
+		// flagged rather than searched for in the active lists, which are pruned on their next tick
+		Tween->bIsPendingRemoval = true;
+		TRACE_TWEEN_STOP(*Tween, bBringToCompletion);
+
+		// the tween may belong to other groups as well
+		if (Tween->Groups.Num() > 1)
+		{
+			RemoveFromGroupIndex(Tween);
+		}
 
-		if(Tween->ObjectPtr == ObjectPtr)
+		if (bBringToCompletion)
 		{
-			if (bComplete)
+			if (Tween->ObjectPtr.IsValid())
 			{
 				Tween->Tick(0.f, 0.f, true);
-
-				Tween->Complete.Broadcast();
-				Tween->CompleteDelegate.Broadcast();
 			}
 
-			ActiveTweens.RemoveAt(Index);
-			bDidRemoveTween = true;
+			Tween->BroadcastComplete();
 		}
 	}
 
-	return bDidRemoveTween;
+	return Members.Tweens.Num();
 }
 
-void UTweenerSubsystem::StopAllTweens(bool bBringToCompletion)
+void UTweenerSubsystem::SetGroupTimeScale(FName Group, float TimeScale)
 {
-	if(bBringToCompletion)
+	if (FTweenerGroupMembers* Members = GroupMembers.Find(Group))
 	{
-		for (auto ActiveTween : ActiveTweens)
+		for (UTween* Tween : Members->Tweens)
 		{
-			if (ActiveTween->ObjectPtr.IsValid())
-			{
-				ActiveTween->Tick(0.f, 0.f, true);
-
-				ActiveTween->Complete.Broadcast();
-				ActiveTween->CompleteDelegate.Broadcast();
-			}
+			Tween->SetTimeScale(TimeScale);
 		}
 	}
+}
 
-	ActiveTweens.Empty();
+TArray<UTween*> UTweenerSubsystem::GetGroupTweens(FName Group) const
+{
+	const FTweenerGroupMembers* Members = GroupMembers.Find(Group);
+
+	return Members ? Members->Tweens : TArray<UTween*>();
 }
 
-void UTweenerSubsystem::SetAllTweenPauseState(bool bIsPaused)
+void UTweenerSubsystem::AddTweenToGroup(UTween* Tween, FName Group)
 {
-	for (auto ActiveTween : ActiveTweens)
+	LLM_SCOPE_BYTAG(Tweener);
+
+	if (!Tween || Group.IsNone())
 	{
-		ActiveTween->bIsPaused = bIsPaused;
+		return;
+	}
+
+	Tween->Groups.AddUnique(Group);
+
+	// tweens join the index when they start, one that is already running has to be added here
+	const FTweenerTweenList* TweenList = FindTweenList(Tween->TickGroup, Tween->TimeDomain);
+
+	if (TweenList && !Tween->bIsPendingRemoval && TweenList->ActiveTweens.Contains(Tween))
+	{
+		GroupMembers.FindOrAdd(Group).Tweens.AddUnique(Tween);
 	}
 }
 
-bool UTweenerSubsystem::IsTweenActive(const UTween* Tween) const
+void UTweenerSubsystem::AddToGroupIndex(UTween* Tween)
 {
-	return ActiveTweens.Contains(Tween);
+	LLM_SCOPE_BYTAG(Tweener);
+
+	for (const FName& Group : Tween->Groups)
+	{
+		GroupMembers.FindOrAdd(Group).Tweens.AddUnique(Tween);
+	}
 }
 
-bool UTweenerSubsystem::ObjectHasActiveTweens(const UObject* Object) const
+void UTweenerSubsystem::RemoveFromGroupIndex(UTween* Tween)
 {
-	const FWeakObjectPtr ObjectPtr = FWeakObjectPtr(Object);
-	
-	for (auto ActiveTween : ActiveTweens)
+	for (const FName& Group : Tween->Groups)
 	{
-		if (ActiveTween->ObjectPtr == ObjectPtr)
+		if (FTweenerGroupMembers* Members = GroupMembers.Find(Group))
 		{
-			return true;
+			Members->Tweens.RemoveSingleSwap(Tween);
+
+			if (Members->Tweens.Num() == 0)
+			{
+				GroupMembers.Remove(Group);
+			}
 		}
 	}
-
-	return false;
 }
 
-
 UTween* UTweenerSubsystem::ComponentLocationTo(USceneComponent* SceneComponent, FVector Location,
                                                bool bIsLocationRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops,
                                                float DelayBetweenLoops, const UObject* WorldContextObject)
@@ -382,6 +1451,69 @@ UTween* UTweenerSubsystem::ActorRelativeRotationFrom(AActor* Actor, FQuat Rotati
 	return StartTween(Tween);
 }
 
+UTween* UTweenerSubsystem::InstanceLocationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Location,
+	bool bIsLocationRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	UTween* Tween = UTween::InstanceLocationTo(InstancedStaticMesh, InstanceIndex, Location, bIsLocationRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+
+	return StartTween(Tween);
+}
+
+UTween* UTweenerSubsystem::InstanceRelativeLocationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Location,
+	bool bIsLocationRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	UTween* Tween = UTween::InstanceRelativeLocationTo(InstancedStaticMesh, InstanceIndex, Location, bIsLocationRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+
+	return StartTween(Tween);
+}
+
+UTween* UTweenerSubsystem::InstanceRotationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FQuat Rotation,
+	bool bIsRotationRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	UTween* Tween = UTween::InstanceRotationTo(InstancedStaticMesh, InstanceIndex, Rotation, bIsRotationRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+
+	return StartTween(Tween);
+}
+
+UTween* UTweenerSubsystem::InstanceRelativeRotationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FQuat Rotation,
+	bool bIsRotationRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	UTween* Tween = UTween::InstanceRelativeRotationTo(InstancedStaticMesh, InstanceIndex, Rotation, bIsRotationRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+
+	return StartTween(Tween);
+}
+
+UTween* UTweenerSubsystem::InstanceScaleTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Scale,
+	bool bIsScaleRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	UTween* Tween = UTween::InstanceScaleTo(InstancedStaticMesh, InstanceIndex, Scale, bIsScaleRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+
+	return StartTween(Tween);
+}
+
+UTween* UTweenerSubsystem::InstanceRelativeScaleTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Scale,
+	bool bIsScaleRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	UTween* Tween = UTween::InstanceRelativeScaleTo(InstancedStaticMesh, InstanceIndex, Scale, bIsScaleRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+
+	return StartTween(Tween);
+}
+
+UTween* UTweenerSubsystem::ComponentPresetTo(USceneComponent* SceneComponent, const UTweenPreset* Preset, FTransform Target, const UObject* WorldContextObject)
+{
+	UTween* Tween = UTween::ComponentPresetTo(SceneComponent, Preset, Target, WorldContextObject);
+
+	return StartTween(Tween);
+}
+
+UTween* UTweenerSubsystem::InstancePresetTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, const UTweenPreset* Preset, FTransform Target,
+	const UObject* WorldContextObject)
+{
+	UTween* Tween = UTween::InstancePresetTo(InstancedStaticMesh, InstanceIndex, Preset, Target, WorldContextObject);
+
+	return StartTween(Tween);
+}
+
 UTween* UTweenerSubsystem::WidgetSlotPositionTo(UWidget* Widget, FVector2D Location, 
 	bool bIsLocationRelative, float Duration, EEaseType EaseType, ELoopType LoopType, int32 Loops, 
 	float DelayBetweenLoops, const UObject* WorldContextObject)
@@ -594,18 +1726,184 @@ UTween* UTweenerSubsystem::CustomAction(UObject* Object, float From, float To, f
 
 UTween* UTweenerSubsystem::StartTween(UTween* Tween)
 {
+	LLM_SCOPE_BYTAG(Tweener);
+
+	if (Tween && Tween->ShouldStripAsCosmetic())
+	{
+		QueueStrippedTween(Tween);
+		return Tween;
+	}
+
 	if (Tween && Tween->PrepareForUse())
 	{
-		ActiveTweens.AddUnique(Tween);
+		AddStartedTween(Tween, true);
 		return Tween;
 	}
 
 	return nullptr;
 }
 
+bool UTweenerSubsystem::StartNewTween(UTween* Tween)
+{
+	if (Tween && Tween->ShouldStripAsCosmetic())
+	{
+		QueueStrippedTween(Tween);
+		return true;
+	}
+
+	if (Tween && Tween->PrepareForUse())
+	{
+		AddStartedTween(Tween, false);
+		return true;
+	}
+
+	return false;
+}
+
+void UTweenerSubsystem::AddStartedTween(UTween* Tween, bool bMayAlreadyBeActive)
+{
+	Tween->StartTimeSeconds = GetWorld()->GetTimeSeconds();
+	Tween->TickCycles = 0;
+
+	TArray<UTween*>& ActiveTweens = GetTweenList(Tween->TickGroup, Tween->TimeDomain).ActiveTweens;
+
+	if (bMayAlreadyBeActive)
+	{
+		ActiveTweens.AddUnique(Tween);
+	}
+	else
+	{
+		ActiveTweens.Add(Tween);
+	}
+
+	AddToGroupIndex(Tween);
+	WakeTickGroup(Tween->TickGroup);
+
+	INC_DWORD_STAT(STAT_TweenerStartedTweens);
+	CSV_CUSTOM_STAT(Tweener, StartedTweens, 1, ECsvCustomStatOp::Accumulate);
+	TRACE_TWEEN_START(*Tween);
+}
+
+void UTweenerSubsystem::QueueStrippedTween(UTween* Tween)
+{
+	GetTickGroup(Tween->TickGroup).PendingStrippedTweens.AddUnique(Tween);
+	WakeTickGroup(Tween->TickGroup);
+}
+
+void UTweenerSubsystem::CompleteStrippedTween(UTween* Tween)
+{
+	// the target is never read or written, gameplay listening for completion carries on as normal
+	{
+		SCOPE_CYCLE_COUNTER(STAT_TweenerEventDispatch);
+		Tween->BroadcastComplete();
+	}
+
+	TRACE_TWEEN_COMPLETE(*Tween);
+
+	if (Tween->NextTween != nullptr)
+	{
+		TRACE_TWEEN_CHAIN_ADVANCE(*Tween, *Tween->NextTween);
+		StartNewTween(Tween->NextTween);
+	}
+}
+
+template <typename TargetType, typename FactoryType>
+TArray<UTween*> UTweenerSubsystem::StartTweensStaggered(const TArray<TargetType*>& Targets, float StaggerDelay, float StaggerJitter, FactoryType Factory)
+{
+	LLM_SCOPE_BYTAG(Tweener);
+
+	TArray<UTween*> Tweens;
+	Tweens.Reserve(Targets.Num());
+	TArray<UTween*>& ActiveTweens = GetTweenList(UTween::DefaultTickGroup, TweenTimeDomain::Gameplay).ActiveTweens;
+	ActiveTweens.Reserve(ActiveTweens.Num() + Targets.Num());
+
+	for (int32 Index = 0; Index < Targets.Num(); ++Index)
+	{
+		UTween* Tween = Factory(Targets[Index]);
+
+		if (!Tween)
+		{
+			continue;
+		}
+
+		const float Jitter = StaggerJitter > 0.f ? FMath::FRandRange(0.f, StaggerJitter) : 0.f;
+		Tween->SetDelay(Tween->Delay + Index * StaggerDelay + Jitter);
+
+		if (StartNewTween(Tween))
+		{
+			Tweens.Add(Tween);
+		}
+	}
+
+	return Tweens;
+}
+
+TArray<UTween*> UTweenerSubsystem::ComponentsLocationTo(const TArray<USceneComponent*>& SceneComponents, FVector Location,
+	bool bIsLocationRelative, float Duration, float StaggerDelay, float StaggerJitter, EEaseType EaseType, ELoopType LoopType,
+	int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return StartTweensStaggered(SceneComponents, StaggerDelay, StaggerJitter, [&](USceneComponent* SceneComponent)
+	{
+		return UTween::ComponentLocationTo(SceneComponent, Location, bIsLocationRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+	});
+}
 
+TArray<UTween*> UTweenerSubsystem::ComponentsRotationTo(const TArray<USceneComponent*>& SceneComponents, FQuat Rotation,
+	bool bIsRotationRelative, float Duration, float StaggerDelay, float StaggerJitter, EEaseType EaseType, ELoopType LoopType,
+	int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return StartTweensStaggered(SceneComponents, StaggerDelay, StaggerJitter, [&](USceneComponent* SceneComponent)
+	{
+		return UTween::ComponentRotationTo(SceneComponent, Rotation, bIsRotationRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+	});
+}
 
+TArray<UTween*> UTweenerSubsystem::ComponentsScaleTo(const TArray<USceneComponent*>& SceneComponents, FVector Scale,
+	bool bIsScaleRelative, float Duration, float StaggerDelay, float StaggerJitter, EEaseType EaseType, ELoopType LoopType,
+	int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return StartTweensStaggered(SceneComponents, StaggerDelay, StaggerJitter, [&](USceneComponent* SceneComponent)
+	{
+		return UTween::ComponentScaleTo(SceneComponent, Scale, bIsScaleRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+	});
+}
 
+TArray<UTween*> UTweenerSubsystem::WidgetsRenderLocationTo(const TArray<UWidget*>& Widgets, FVector2D Location,
+	bool bIsLocationRelative, float Duration, float StaggerDelay, float StaggerJitter, EEaseType EaseType, ELoopType LoopType,
+	int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return StartTweensStaggered(Widgets, StaggerDelay, StaggerJitter, [&](UWidget* Widget)
+	{
+		return UTween::WidgetRenderLocationTo(Widget, Location, bIsLocationRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+	});
+}
 
+TArray<UTween*> UTweenerSubsystem::WidgetsRenderScaleTo(const TArray<UWidget*>& Widgets, FVector2D Scale,
+	bool bIsScaleRelative, float Duration, float StaggerDelay, float StaggerJitter, EEaseType EaseType, ELoopType LoopType,
+	int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return StartTweensStaggered(Widgets, StaggerDelay, StaggerJitter, [&](UWidget* Widget)
+	{
+		return UTween::WidgetRenderScaleTo(Widget, Scale, bIsScaleRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+	});
+}
 
+TArray<UTween*> UTweenerSubsystem::WidgetsRenderOpacityTo(const TArray<UWidget*>& Widgets, float Opacity,
+	bool bIsOpacityRelative, float Duration, float StaggerDelay, float StaggerJitter, EEaseType EaseType, ELoopType LoopType,
+	int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return StartTweensStaggered(Widgets, StaggerDelay, StaggerJitter, [&](UWidget* Widget)
+	{
+		return UTween::WidgetRenderOpacityTo(Widget, Opacity, bIsOpacityRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+	});
+}
 
+TArray<UTween*> UTweenerSubsystem::WidgetsColorTo(const TArray<UWidget*>& Widgets, FLinearColor Color,
+	bool bIsColorRelative, float Duration, float StaggerDelay, float StaggerJitter, EEaseType EaseType, ELoopType LoopType,
+	int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject)
+{
+	return StartTweensStaggered(Widgets, StaggerDelay, StaggerJitter, [&](UWidget* Widget)
+	{
+		return UTween::WidgetColorTo(Widget, Color, bIsColorRelative, Duration, EaseType, LoopType, Loops, DelayBetweenLoops, WorldContextObject);
+	});
+}
@@ -0,0 +1,106 @@
+#include "TweenerTrace.h"
+
+#if TWEENER_TRACE_ENABLED
+
+#include "Tween.h"
+#include "HAL/PlatformTime.h"
+
+UE_TRACE_CHANNEL_DEFINE(TweenerChannel);
+
+UE_TRACE_EVENT_BEGIN(Tweener, TweenStart)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TweenId)
+	UE_TRACE_EVENT_FIELD(uint64, TargetId)
+	UE_TRACE_EVENT_FIELD(float, Duration)
+	UE_TRACE_EVENT_FIELD(int32, Loops)
+	UE_TRACE_EVENT_FIELD(uint8, TargetType)
+	UE_TRACE_EVENT_FIELD(uint8, TweenType)
+	UE_TRACE_EVENT_FIELD(uint8, EaseType)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, TargetName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Tweener, TweenChainAdvance)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TweenId)
+	UE_TRACE_EVENT_FIELD(uint64, NextTweenId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Tweener, TweenLoop)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TweenId)
+	UE_TRACE_EVENT_FIELD(int32, LoopsRemaining)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Tweener, TweenStop)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TweenId)
+	UE_TRACE_EVENT_FIELD(bool, bBroughtToCompletion)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Tweener, TweenComplete)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TweenId)
+UE_TRACE_EVENT_END()
+
+namespace TweenerTrace
+{
+	static uint64 GetId(const void* Object)
+	{
+		return static_cast<uint64>(reinterpret_cast<UPTRINT>(Object));
+	}
+}
+
+void FTweenerTrace::OutputStart(const UTween& Tween)
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(TweenerChannel))
+	{
+		return;
+	}
+
+	const UObject* Target = Tween.ObjectPtr.Get();
+	const FString TargetName = Target ? Target->GetPathName() : FString();
+
+	UE_TRACE_LOG(Tweener, TweenStart, TweenerChannel)
+		<< TweenStart.Cycle(FPlatformTime::Cycles64())
+		<< TweenStart.TweenId(TweenerTrace::GetId(&Tween))
+		<< TweenStart.TargetId(TweenerTrace::GetId(Target))
+		<< TweenStart.Duration(Tween.Duration)
+		<< TweenStart.Loops(Tween.LoopType != ELoopType::None ? Tween.Loops : 0)
+		<< TweenStart.TargetType(static_cast<uint8>(Tween.TargetObjectType))
+		<< TweenStart.TweenType(static_cast<uint8>(Tween.TweenType))
+		<< TweenStart.EaseType(static_cast<uint8>(Tween.EaseType))
+		<< TweenStart.TargetName(*TargetName, TargetName.Len());
+}
+
+void FTweenerTrace::OutputChainAdvance(const UTween& Tween, const UTween& NextTween)
+{
+	UE_TRACE_LOG(Tweener, TweenChainAdvance, TweenerChannel)
+		<< TweenChainAdvance.Cycle(FPlatformTime::Cycles64())
+		<< TweenChainAdvance.TweenId(TweenerTrace::GetId(&Tween))
+		<< TweenChainAdvance.NextTweenId(TweenerTrace::GetId(&NextTween));
+}
+
+void FTweenerTrace::OutputLoop(const UTween& Tween)
+{
+	UE_TRACE_LOG(Tweener, TweenLoop, TweenerChannel)
+		<< TweenLoop.Cycle(FPlatformTime::Cycles64())
+		<< TweenLoop.TweenId(TweenerTrace::GetId(&Tween))
+		<< TweenLoop.LoopsRemaining(Tween.Loops);
+}
+
+void FTweenerTrace::OutputStop(const UTween& Tween, bool bBroughtToCompletion)
+{
+	UE_TRACE_LOG(Tweener, TweenStop, TweenerChannel)
+		<< TweenStop.Cycle(FPlatformTime::Cycles64())
+		<< TweenStop.TweenId(TweenerTrace::GetId(&Tween))
+		<< TweenStop.bBroughtToCompletion(bBroughtToCompletion);
+}
+
+void FTweenerTrace::OutputComplete(const UTween& Tween)
+{
+	UE_TRACE_LOG(Tweener, TweenComplete, TweenerChannel)
+		<< TweenComplete.Cycle(FPlatformTime::Cycles64())
+		<< TweenComplete.TweenId(TweenerTrace::GetId(&Tween));
+}
+
+#endif
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Config.h"
+
+class UTween;
+
+#define TWEENER_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if TWEENER_TRACE_ENABLED
+
+#include "Trace/Trace.h"
+
+UE_TRACE_CHANNEL_EXTERN(TweenerChannel);
+
+/**
+ * Tween lifecycle events for Unreal Insights, on the Tweener trace channel (-trace=tweener).
+ * Tweens and targets are identified by address, targets also carry their path name on start.
+ */
+struct FTweenerTrace
+{
+	static void OutputStart(const UTween& Tween);
+	static void OutputChainAdvance(const UTween& Tween, const UTween& NextTween);
+	static void OutputLoop(const UTween& Tween);
+	static void OutputStop(const UTween& Tween, bool bBroughtToCompletion);
+	static void OutputComplete(const UTween& Tween);
+};
+
+#define TRACE_TWEEN_START(Tween) FTweenerTrace::OutputStart(Tween)
+#define TRACE_TWEEN_CHAIN_ADVANCE(Tween, NextTween) FTweenerTrace::OutputChainAdvance(Tween, NextTween)
+#define TRACE_TWEEN_LOOP(Tween) FTweenerTrace::OutputLoop(Tween)
+#define TRACE_TWEEN_STOP(Tween, bBroughtToCompletion) FTweenerTrace::OutputStop(Tween, bBroughtToCompletion)
+#define TRACE_TWEEN_COMPLETE(Tween) FTweenerTrace::OutputComplete(Tween)
+
+#else
+
+#define TRACE_TWEEN_START(Tween)
+#define TRACE_TWEEN_CHAIN_ADVANCE(Tween, NextTween)
+#define TRACE_TWEEN_LOOP(Tween)
+#define TRACE_TWEEN_STOP(Tween, bBroughtToCompletion)
+#define TRACE_TWEEN_COMPLETE(Tween)
+
+#endif
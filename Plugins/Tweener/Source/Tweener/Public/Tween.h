@@ -2,12 +2,18 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintAsyncActionBase.h"
+#include "Engine/EngineBaseTypes.h"
 #include "UObject/NoExportTypes.h"
+#include "TweenCubicBezier.h"
 #include "Tween.generated.h"
 
+class UInstancedStaticMeshComponent;
+class UTweenPreset;
 class UMaterialInstanceDynamic;
 class UWidget;
 class FProperty;
+class UTween;
+class UTweenerSubsystem;
 
 
 //Line up with EControlRigAnimEasingType
@@ -46,6 +52,7 @@ enum class EEaseType : uint8
 	BounceEaseOut,
 	BounceEaseInOut,
 	Punch,
+	CubicBezier UMETA(ToolTip = "Use SetCubicBezier to provide the control points"),
 };
 
 UENUM()
@@ -55,7 +62,8 @@ enum class ETweenTargetObjectType : uint8
 	Material,
 	Widget,
 	Property,
-	CustomAction
+	CustomAction,
+	InstancedStaticMesh
 };
 
 
@@ -99,11 +107,52 @@ enum class ETargetValueType : uint8
 	Scalar
 };
 
+/** How often a significance throttled tween is updated, see UTween::SetSignificanceThrottled */
+UENUM(BlueprintType)
+enum class ETweenSignificance : uint8
+{
+	Full,
+	Reduced,
+	Frozen
+};
+
+UENUM(BlueprintType)
+enum class ETweenPriority : uint8
+{
+	/** Deferred to a later frame once tweener.Budget.Milliseconds has been spent */
+	Low,
+	/** Always updated */
+	High
+};
+
+/** Built in clocks for UTween::SetTimeDomain. UI runs on real time, the others on world time. */
+namespace TweenTimeDomain
+{
+	TWEENER_API extern const FName Gameplay;
+	TWEENER_API extern const FName UI;
+	TWEENER_API extern const FName Cinematic;
+}
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FTweenOutputPin);
 DECLARE_MULTICAST_DELEGATE(FTweenDelegate);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FTweenCustomAction, UObject*,Object,float,EasedValue,float,Value);
 
+/** UTween's versions of the above, which take no storage in the tween until they are bound */
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE(FTweenCompleteSparse, UTween, Complete);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE(FTweenLoopCompleteSparse, UTween, LoopComplete);
+DECLARE_DYNAMIC_MULTICAST_SPARSE_DELEGATE_ThreeParams(FTweenCustomActionSparse, UTween, Action, UObject*, Object, float, EasedValue, float, Value);
+
+/** Non-dynamic versions of UTween::Complete and UTween::LoopComplete, allocated the first time either is bound */
+struct FTweenNativeDelegates
+{
+	FTweenDelegate Complete;
+	FTweenDelegate LoopComplete;
+};
+
+/** Returns true, and sets the significance, to override the built in significance checks for the tween */
+DECLARE_DELEGATE_RetVal_TwoParams(bool, FTweenSignificanceOverride, const UTween& /*Tween*/, ETweenSignificance& /*OutSignificance*/);
+
 
 /**
  * 
@@ -235,6 +284,44 @@ public:
 		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
 		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
 
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	static UTween* InstanceLocationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Location, bool bIsLocationRelative = true, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	static UTween* InstanceRelativeLocationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Location, bool bIsLocationRelative = true, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	static UTween* InstanceRotationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FQuat Rotation, bool bIsRotationRelative = false, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	static UTween* InstanceRelativeRotationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FQuat Rotation, bool bIsRotationRelative = false, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	static UTween* InstanceScaleTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Scale = FVector(1.0f, 1.0f, 1.0f), bool bIsScaleRelative = false, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	static UTween* InstanceRelativeScaleTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Scale = FVector(1.0f, 1.0f, 1.0f), bool bIsScaleRelative = false, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	/** Tweens the part of the component's transform the preset drives to Target, with the preset's timing */
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "Tween")
+	static UTween* ComponentPresetTo(USceneComponent* SceneComponent, const UTweenPreset* Preset, FTransform Target, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "Tween")
+	static UTween* InstancePresetTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, const UTweenPreset* Preset, FTransform Target,
+		const UObject* WorldContextObject = nullptr);
+
 	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", AdvancedDisplay = 4), Category = "Tween")
 	static UTween* WidgetSlotPositionTo(UWidget* Widget, FVector2D Location, bool bIsLocationRelative = false, float Duration = 0.25f,
 			EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
@@ -397,6 +484,10 @@ public:
 	UFUNCTION(BlueprintCallable)
 	UTween* SetEaseType(EEaseType InEaseType);
 
+	/** Eases with a CSS style cubic-bezier(X1, Y1, X2, Y2). Tweens with the same control points share one solved curve. */
+	UFUNCTION(BlueprintCallable)
+	UTween* SetCubicBezier(float X1, float Y1, float X2, float Y2);
+
 	UFUNCTION(BlueprintCallable)
 	UTween* SetLoopType(ELoopType InLoopType, int InLoops, float InDelayBetweenLoops);
 
@@ -406,6 +497,73 @@ public:
 	UFUNCTION(BlueprintCallable)
 	UTween* SetTimeScaleIndependent();
 
+	/**
+	 * Adds the tween to a group, see UTweenerSubsystem::StopGroup. A running tween joins the group straight away.
+	 * Tweens chained after this one join the same groups.
+	 */
+	UFUNCTION(BlueprintCallable)
+	UTween* AddToGroup(FName Group);
+
+	/** Multiplies the tween's delta time, on top of its time domain */
+	UFUNCTION(BlueprintCallable)
+	UTween* SetTimeScale(float InTimeScale);
+
+	/**
+	 * Lets the subsystem update the tween less often, or not at all, while its target is off screen, far from every view
+	 * or hidden. Skipped time is caught up in one step and the end of each loop is never held back, so delegates fire on time.
+	 * Not suitable for tweens that bring their target into view, as it is only updated once it has been rendered.
+	 */
+	UFUNCTION(BlueprintCallable)
+	UTween* SetSignificanceThrottled(bool bInIsSignificanceThrottled = true);
+
+	/**
+	 * Marks the tween as purely visual. Widget and material tweens always are. On dedicated servers and -nullrhi runs
+	 * cosmetic tweens don't touch their target, they complete as soon as they are started.
+	 */
+	UFUNCTION(BlueprintCallable)
+	UTween* SetCosmetic(bool bInIsCosmetic = true);
+
+	bool IsCosmetic() const;
+
+	/** True when the tween is cosmetic and nothing here can see it, see tweener.StripCosmeticTweens */
+	bool ShouldStripAsCosmetic() const;
+
+	/** Low priority tweens are skipped, and catch up later, once the frame's tween budget has been spent */
+	UFUNCTION(BlueprintCallable)
+	UTween* SetPriority(ETweenPriority InPriority);
+
+	/** Runs the tween on the named clock, see UTweenerSubsystem::SetTimeDomainScale. A running tween moves over to it. */
+	UFUNCTION(BlueprintCallable)
+	UTween* SetTimeDomain(FName InTimeDomain);
+
+	/** Updates the tween during InTickGroup instead of after the world has ticked. A running tween moves over to it. */
+	UFUNCTION(BlueprintCallable)
+	UTween* SetTickGroup(ETickingGroup InTickGroup);
+
+	/**
+	 * Drives the tween with a critically damped spring instead of Duration and EaseType.
+	 * The tween sleeps once it settles on the target and wakes up again when the target is changed. Settling isn't
+	 * completion, a spring only fires Complete and starts its NextTween when it is stopped.
+	 * @param HalfLife - Time taken to cover half the remaining distance to the target
+	 */
+	UFUNCTION(BlueprintCallable)
+	UTween* SetSpring(float HalfLife = 0.1f);
+
+	UFUNCTION(BlueprintCallable)
+	void SetSpringTargetVector(FVector VectorTo);
+
+	UFUNCTION(BlueprintCallable)
+	void SetSpringTargetRotation(FQuat RotationTo);
+
+	UFUNCTION(BlueprintCallable)
+	void SetSpringTargetColor(FLinearColor ColorTo);
+
+	UFUNCTION(BlueprintCallable)
+	void SetSpringTargetScalar(float ScalarTo);
+
+	/** Retargets a spring tween, keeping its current value and velocity */
+	void SetSpringTarget(const FVector4& Target);
+
 	UFUNCTION(BlueprintCallable)
 	void ReverseTween();
 	
@@ -415,15 +573,81 @@ public:
 	UFUNCTION(BlueprintCallable)
 	bool IsActive() const;
 
-	//These are aliased as Vectors/Quaternions/Scalar as needed
+	/**
+	 * Start and end values at float precision, aliased as Vectors/Quaternions/Scalar as needed. Vector channels are
+	 * stored relative to ValueOrigin, use GetStartValue and GetEndValue for the full values. For springs StartValue
+	 * tracks the current value.
+	 *
+	 * Everything from here to Priority is read on every update and is kept to 128 bytes, see Tween.cpp.
+	 */
 	UPROPERTY()
-	FVector4 TargetValue;
+	FVector4f StartValue;
 
 	UPROPERTY()
-	FVector4 StartValue;
+	FVector4f EndValue;
 
+	/** Start of a vector channel at full precision, so locations far from the world origin don't lose any. Zero for the others. */
 	UPROPERTY()
-	FVector4 EndValue;
+	FVector ValueOrigin;
+
+	FWeakObjectPtr ObjectPtr;
+
+	UPROPERTY()
+	float ElapsedTime;
+
+	UPROPERTY()
+	float Duration;
+
+	UPROPERTY()
+	float Delay;
+
+	UPROPERTY()
+	float TimeScale = 1.f;
+
+	/** Time skipped by significance throttling or the frame budget, to be caught up on the next update */
+	float PendingDeltaTime = 0.f;
+	float PendingUnscaledDeltaTime = 0.f;
+
+	UPROPERTY()
+	int32 Loops = 0;
+
+	/** Material parameter index, or instance index for instanced static meshes */
+	UPROPERTY()
+	int32 ParameterIndex;
+
+	/** Cached property pointer */
+	FProperty* CachedProperty;
+
+	/** Shared, pre-solved curve used when EaseType is CubicBezier */
+	TSharedPtr<const FTweenCubicBezierCurve> CubicBezierCurve;
+
+	UPROPERTY()
+	uint8 bIsRunningInReverse : 1;
+
+	UPROPERTY()
+	uint8 bIsRelativeTween : 1;
+
+	UPROPERTY()
+	uint8 bIsPaused : 1;
+
+	UPROPERTY()
+	uint8 bIsTimeScaleIndependent : 1;
+
+	UPROPERTY()
+	uint8 bIsSpring : 1;
+
+	UPROPERTY()
+	uint8 bIsSpringAsleep : 1;
+
+	UPROPERTY()
+	uint8 bIsCosmetic : 1;
+
+	/** Defaults to tweener.Significance.ThrottleByDefault */
+	UPROPERTY()
+	uint8 bIsSignificanceThrottled : 1;
+
+	/** Stopped through its group, the subsystem drops it from the active list on its next tick */
+	uint8 bIsPendingRemoval : 1;
 
 	UPROPERTY()
 	ETweenType TweenType;
@@ -434,26 +658,59 @@ public:
 	UPROPERTY()
 	EEaseType EaseType;
 
-	FWeakObjectPtr ObjectPtr;
-
 	UPROPERTY()
-	bool bIsTimeScaleIndependent;
+	ELoopType LoopType;
 
 	UPROPERTY()
-	bool bIsRunningInReverse;
+	ETweenPriority Priority = ETweenPriority::High;
 
+	/** Target as given, relative or absolute. Kept at full precision until CalculateEndValue. */
 	UPROPERTY()
-	bool bIsRelativeTween;
+	FVector4 TargetValue;
 
+	/** Spring velocity per component, or angular velocity in XYZ for rotations */
 	UPROPERTY()
-	float Duration;
+	FVector4f SpringVelocity;
 
 	UPROPERTY()
-	float Delay;
+	float SpringHalfLife;
 
 	UPROPERTY()
 	float DelayBetweenLoops;
 
+	/** Preset the tween was started from, if any */
+	UPROPERTY()
+	const UTweenPreset* Preset;
+
+	/** Tick group updating the tween, after everything else in the world has ticked by default */
+	static constexpr ETickingGroup DefaultTickGroup = TG_PostUpdateWork;
+
+	UPROPERTY()
+	TEnumAsByte<ETickingGroup> TickGroup = DefaultTickGroup;
+
+	ETweenSignificance Significance = ETweenSignificance::Full;
+
+	/** Time until the significance of a throttled tween is checked again */
+	float SignificanceCheckCountdown = 0.f;
+
+	UPROPERTY()
+	FName TimeDomain = TweenTimeDomain::Gameplay;
+
+	UPROPERTY()
+	TArray<FName> Groups;
+
+	/** World time the tween was last started at, see tweener.top */
+	double StartTimeSeconds = 0.0;
+
+	/** Cycles spent in Tick since the tween was started, while tweener.TrackCost is on */
+	uint64 TickCycles = 0;
+
+	/**
+	 * Progress through the delay and duration in a fixed step time domain, in FixedStepSubdivisions parts of a step.
+	 * Negative when ElapsedTime has been set from outside and the count has to be worked out from it again.
+	 */
+	int64 FixedStepUnits = INDEX_NONE;
+
 	//AnimationCurve animCurve;
 
 	UPROPERTY()
@@ -462,43 +719,48 @@ public:
 	UPROPERTY()
 	FName ParameterName;
 
-	UPROPERTY()
-	int32 ParameterIndex;
-
-	/** Cached property pointer */
-	FProperty* CachedProperty;
-	
 	UPROPERTY(BlueprintAssignable)
-	FTweenCustomAction Action;
+	FTweenCustomActionSparse Action;
 	
 	UPROPERTY(BlueprintAssignable)
-	FTweenOutputPin Complete;
-	FTweenDelegate CompleteDelegate; // Non-dynamic version
+	FTweenCompleteSparse Complete;
 
 	UPROPERTY(BlueprintAssignable)
-	FTweenOutputPin LoopComplete;
-	FTweenDelegate LoopCompleteDelegate; // Non-dynamic version
-	
-	// internal state
+	FTweenLoopCompleteSparse LoopComplete;
 
-	UPROPERTY()
-	float ElapsedTime;
+	/** Non-dynamic version of Complete. Allocates the native delegates, so only call it to bind. */
+	FTweenDelegate& OnComplete();
 
-	UPROPERTY()
-	bool bIsPaused;
+	/** Non-dynamic version of LoopComplete. Allocates the native delegates, so only call it to bind. */
+	FTweenDelegate& OnLoopComplete();
 
-	UPROPERTY()
-	ELoopType LoopType;
+	/** Fires Complete and its non-dynamic version */
+	void BroadcastComplete();
 
-	UPROPERTY()
-	int32 Loops = 0;
+	FVector4 GetStartValue() const { return FromStoredValue(StartValue); }
+
+	FVector4 GetEndValue() const { return FromStoredValue(EndValue); }
+
+	/** Sets the start value, rebasing ValueOrigin on it. The end value is kept where it was. */
+	void SetStartValue(const FVector4& Value);
+
+	void SetEndValue(const FVector4& Value) { EndValue = ToStoredValue(Value); }
 
 	// UBlueprintAsyncActionBase interface
 	virtual void Activate() override;
 	//~UBlueprintAsyncActionBase interface
 
+	// UObject interface
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+	//~UObject interface
+
 
 	float PercentComplete() const;
+
+	/** Time from activation until the last loop completes, including delays. Max float for infinite loops */
+	float GetTotalDuration() const;
+
+	float Ease(float Alpha) const;
 	
 	/**
 	 * handles the tween. returns true if it is complete and ready for removal
@@ -509,6 +771,13 @@ public:
 	 */
 	bool Tick(float DeltaTime, float UnscaledDeltaTime, bool bCompleteTweenThisStep = false);
 
+	/**
+	 * Tick for a tween in a fixed step time domain, advancing one step. Progress is counted in whole steps rather than
+	 * summed as float time, so the tween lasts ceil(Duration * StepsPerSecond) steps and lands on the same values at
+	 * the same step on every run.
+	 */
+	bool TickFixedStep(int32 StepsPerSecond);
+
 	void SetValueEnd() const;
 
 	static bool GetValueWidget(FVector4& OutVec, const UWidget& Widget, ETweenType TweenType);
@@ -519,6 +788,9 @@ public:
 	
 private:
 
+	friend class UTweenReplicationComponent;
+	friend class FTweenSaveArchive;
+
 	static UTween* NewTween(FWeakObjectPtr ObjectPtr, ETweenTargetObjectType TweenTargetObject,
 		ETweenType TweenType, FVector4 Target, bool bIsRelative, float Duration,
 		EEaseType EaseType,
@@ -527,6 +799,10 @@ private:
 	static UTween* NewTweenSceneComponent(USceneComponent* SceneComponent, ETweenType TweenType, FVector4 Target, bool bIsRelative, float Duration,
 	                               EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops,
 	                               const UObject* WorldContextObject);
+	static UTween* NewTweenInstancedStaticMesh(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, ETweenType TweenType, FVector4 Target, bool bIsRelative, float Duration,
+	                               EEaseType EaseType, ELoopType LoopType, int32 Loops, float DelayBetweenLoops,
+	                               const UObject* WorldContextObject);
+
 	static UTween* NewTweenSceneComponentFrom(USceneComponent* SceneComponent, ETweenType TweenType, FVector4 From,
 	                                   bool bIsRelative, float Duration, EEaseType EaseType, ELoopType LoopType,
 	                                   int32 Loops, float DelayBetweenLoops, const UObject* WorldContextObject);
@@ -539,10 +815,37 @@ private:
 
 	void HandleLooping();
 
+	/** Eases Alpha, already reversed for tweens running in reverse, and applies the value. Returns bIsAtEnd. */
+	bool ApplyProgress(float Alpha, bool bIsAtEnd);
+
+	/** A time scale of 1 moves a fixed step tween this many units a step, finer scales are rounded to the nearest unit */
+	static constexpr int64 FixedStepSubdivisions = 1024;
+
+	/** Subsystem of the world the tween runs in */
+	UTweenerSubsystem* FindSubsystem() const;
+
+	void BroadcastLoopComplete();
+
+	FVector4f ToStoredValue(const FVector4& Value) const { return FVector4f(Value - FVector4(ValueOrigin, 0.)); }
+
+	FVector4 FromStoredValue(const FVector4f& Value) const { return FVector4(Value) + FVector4(ValueOrigin, 0.); }
+
+	/** Takes timing and easing from the preset, sharing its baked curve */
+	void ApplyPreset(const UTweenPreset& InPreset);
+
+	bool TickSpring(float DeltaTime, bool bCompleteTweenThisStep);
+
+	void CalculateEndValue();
+
+	/** Settings a chained tween inherits from the one before it */
+	void CopyChainSettingsTo(UTween* Tween) const;
+
 	void SetAsRequiredPerCurrentTweenType(const FVector4& Vec) const;
 
 	static void SetValueSceneComponent(const FVector4& Vec, USceneComponent& SceneComponent, ETweenType TweenType);
 
+	static void SetValueInstancedStaticMesh(const FVector4& Vec, UInstancedStaticMeshComponent& InstancedStaticMesh, ETweenType TweenType, int32 InstanceIndex);
+
 	static void SetValueMaterial(const FVector4& Vec, UMaterialInstanceDynamic& Material, ETweenType TweenType, int32 ParameterIndex);
 	
 	static void SetWidgetColorAndOpacity(UWidget& Widget, FLinearColor ColorAndOpacity, ETweenType TweenType);
@@ -553,9 +856,16 @@ private:
 
 	bool CacheInitialValues();
 
+	/** Reads the target's current value, custom actions leave OutValue as it is */
+	bool GetInitialValue(FVector4& OutValue);
+
+	/** Finds CachedProperty from ParameterName for a property tween */
+	bool CacheProperty();
+
 	ETargetValueType GetTargetValueType() const;
 	
 	static bool GetValueSceneComponent(FVector4& OutVec, const USceneComponent& SceneComponent, ETweenType TweenType);
+	static bool GetValueInstancedStaticMesh(FVector4& OutVec, UInstancedStaticMeshComponent& InstancedStaticMesh, ETweenType TweenType, int32 InstanceIndex);
 	static bool GetValueMaterial(FVector4& OutVec, int32& OutParameterIndex, UMaterialInstanceDynamic& Material, FName ParameterName, ETweenType TweenType);
 
 	static FLinearColor GetWidgetColorAndOpacity(const UWidget& Widget, ETweenType TweenType);
@@ -563,6 +873,8 @@ private:
 	static bool GetValueProperty(FVector4& OutVec, FProperty*& OutProperty, const UObject& Object, FName ParameterName, ETweenType TweenType);
 
 	const UObject* WorldContextObject;
+
+	TUniquePtr<FTweenNativeDelegates> NativeDelegates;
 	
 };
 
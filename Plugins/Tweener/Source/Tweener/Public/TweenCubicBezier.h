@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Control points of a CSS style cubic-bezier(X1, Y1, X2, Y2) curve. P0 is (0,0) and P3 is (1,1).
+ */
+struct TWEENER_API FTweenCubicBezierKey
+{
+	float X1 = 0.f;
+	float Y1 = 0.f;
+	float X2 = 1.f;
+	float Y2 = 1.f;
+
+	FTweenCubicBezierKey() = default;
+
+	FTweenCubicBezierKey(float InX1, float InY1, float InX2, float InY2)
+		: X1(FMath::Clamp(InX1, 0.f, 1.f)), Y1(InY1), X2(FMath::Clamp(InX2, 0.f, 1.f)), Y2(InY2)
+	{
+	}
+
+	bool operator==(const FTweenCubicBezierKey& Other) const
+	{
+		return X1 == Other.X1 && Y1 == Other.Y1 && X2 == Other.X2 && Y2 == Other.Y2;
+	}
+
+	friend uint32 GetTypeHash(const FTweenCubicBezierKey& Key)
+	{
+		uint32 Hash = GetTypeHash(Key.X1);
+		Hash = HashCombine(Hash, GetTypeHash(Key.Y1));
+		Hash = HashCombine(Hash, GetTypeHash(Key.X2));
+		return HashCombine(Hash, GetTypeHash(Key.Y2));
+	}
+};
+
+/**
+ * Immutable, pre-solved cubic-bezier ease. The Newton/bisection solve for the curve parameter is done once
+ * when the curve is built; evaluation is a lookup and a lerp into the sample table.
+ */
+class TWEENER_API FTweenCubicBezierCurve
+{
+public:
+
+	static constexpr int32 NumSamples = 256;
+
+	explicit FTweenCubicBezierCurve(const FTweenCubicBezierKey& InKey);
+
+	/** Eased value for Alpha in [0,1] */
+	float Evaluate(float Alpha) const
+	{
+		const float Position = FMath::Clamp(Alpha, 0.f, 1.f) * (NumSamples - 1);
+		const int32 Index = FMath::Min(FMath::FloorToInt(Position), NumSamples - 2);
+		return FMath::Lerp(Samples[Index], Samples[Index + 1], Position - Index);
+	}
+
+	const FTweenCubicBezierKey& GetKey() const { return Key; }
+
+	/** Reference evaluation that solves the curve directly, used to build the table */
+	static float Solve(const FTweenCubicBezierKey& Key, float X);
+
+	/**
+	 * Returns the shared curve for these control points, building it if no other tween is using it.
+	 * Game thread only.
+	 */
+	static TSharedRef<const FTweenCubicBezierCurve> FindOrCreate(const FTweenCubicBezierKey& Key);
+
+private:
+
+	FTweenCubicBezierKey Key;
+
+	float Samples[NumSamples];
+};
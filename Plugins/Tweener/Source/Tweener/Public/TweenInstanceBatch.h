@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UInstancedStaticMeshComponent;
+
+/**
+ * Collects per-instance transform changes made by tweens so each instanced static mesh component is
+ * updated with a few BatchUpdateInstancesTransforms calls and one render state dirty per frame.
+ * Transforms are held in component (local) space. Owned by the subsystem of each world, game thread only.
+ */
+class FTweenInstanceBatch
+{
+public:
+
+	/** Local transform of the instance, including any change queued this frame */
+	bool GetInstanceTransform(UInstancedStaticMeshComponent& Component, int32 InstanceIndex, FTransform& OutTransform) const;
+
+	/** Queues a local transform for the instance, replacing any queued earlier this frame */
+	void SetInstanceTransform(UInstancedStaticMeshComponent& Component, int32 InstanceIndex, const FTransform& Transform);
+
+	/** Commits everything queued since the last flush */
+	void Flush();
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+
+	/** Sends the queued transforms for FirstIndex to LastIndex, filling any gaps with the current ones */
+	void FlushRange(UInstancedStaticMeshComponent& Component, const TMap<int32, FTransform>& PendingInstances, int32 FirstIndex, int32 LastIndex);
+
+	TMap<TWeakObjectPtr<UInstancedStaticMeshComponent>, TMap<int32, FTransform>> PendingComponents;
+
+	/** Reused between flushes to avoid reallocating */
+	TArray<int32> ScratchIndices;
+
+	TArray<FTransform> ScratchTransforms;
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Tween.h"
+#include "TweenPreset.generated.h"
+
+/**
+ * Shared timing for transform tweens, so the same feel can be reused across many call sites and tuned in one place.
+ * Start one with UTween::ComponentPresetTo or UTween::InstancePresetTo. A preset is read only at runtime and
+ * checked when it is saved and cooked.
+ */
+UCLASS(BlueprintType)
+class TWEENER_API UTweenPreset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** What the tween drives. Only the matching part of the target transform is used. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Tween")
+	ETweenType TweenType = ETweenType::RelativeLocation;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Tween")
+	bool bIsRelative = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Tween", meta = (ClampMin = "0"))
+	float Duration = 0.25f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Tween", meta = (ClampMin = "0"))
+	float Delay = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Ease")
+	EEaseType EaseType = EEaseType::QuarticEaseIn;
+
+	/** Control points X1, Y1, X2, Y2, baked into a curve table when the preset loads */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Ease", meta = (EditCondition = "EaseType == EEaseType::CubicBezier"))
+	FVector4 CubicBezier = FVector4(0.25f, 0.1f, 0.25f, 1.f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loop")
+	ELoopType LoopType = ELoopType::None;
+
+	/** 0 loops forever */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loop", meta = (ClampMin = "0", EditCondition = "LoopType != ELoopType::None"))
+	int32 Loops = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loop", meta = (ClampMin = "0", EditCondition = "LoopType != ELoopType::None"))
+	float DelayBetweenLoops = 0.f;
+
+	/** Curve shared by every tween started from the preset, when EaseType is CubicBezier */
+	const TSharedPtr<const FTweenCubicBezierCurve>& GetCubicBezierCurve() const { return CubicBezierCurve; }
+
+	/** The part of Target the preset's TweenType drives */
+	FVector4 GetTargetValue(const FTransform& Target) const;
+
+	/** Appends a message for each setting that can't work, returns true if there were none */
+	bool Validate(TArray<FText>& OutErrors) const;
+
+	// UObject interface
+	virtual void PostLoad() override;
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
+	//~UObject interface
+
+private:
+
+	void BakeCurve();
+
+	TSharedPtr<const FTweenCubicBezierCurve> CubicBezierCurve;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Tween.h"
+#include "TweenReplicationComponent.generated.h"
+
+/** Everything a client needs to play a scene component tween started on the server */
+USTRUCT()
+struct FTweenReplicatedDescriptor
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Id = INDEX_NONE;
+
+	UPROPERTY()
+	USceneComponent* Target = nullptr;
+
+	UPROPERTY()
+	ETweenType TweenType = ETweenType::Location;
+
+	UPROPERTY()
+	EEaseType EaseType = EEaseType::Linear;
+
+	/** X1, Y1, X2, Y2 when EaseType is CubicBezier */
+	UPROPERTY()
+	FVector4 CubicBezier = FVector4(0.f, 0.f, 1.f, 1.f);
+
+	UPROPERTY()
+	ELoopType LoopType = ELoopType::None;
+
+	UPROPERTY()
+	int32 Loops = 0;
+
+	UPROPERTY()
+	float Duration = 0.f;
+
+	UPROPERTY()
+	float Delay = 0.f;
+
+	UPROPERTY()
+	float DelayBetweenLoops = 0.f;
+
+	/** Resolved on the server, so relative tweens land in the same place on every client */
+	UPROPERTY()
+	FVector4 StartValue = FVector4(0.f, 0.f, 0.f, 0.f);
+
+	UPROPERTY()
+	FVector4 EndValue = FVector4(0.f, 0.f, 0.f, 0.f);
+
+	/** AGameStateBase::GetServerWorldTimeSeconds when the server started the tween */
+	UPROPERTY()
+	double ServerStartTime = 0.0;
+};
+
+/**
+ * Replicates tweens on the owning actor's scene components as one descriptor per tween instead of a stream of
+ * transforms. Clients evaluate the tween locally against the synchronized server clock, late joiners fast forward
+ * to where the server is, and a tween the server stops early is corrected with its final transform.
+ * Turn off Replicate Movement on the owner for anything this component drives, or the per-frame transforms still flow.
+ */
+UCLASS(ClassGroup = (Tweener), meta = (BlueprintSpawnableComponent))
+class TWEENER_API UTweenReplicationComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UTweenReplicationComponent();
+
+	/**
+	 * Starts a tween made by one of the UTween scene component factories on the server and replicates it.
+	 * The tween's target must belong to this component's owner.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Tween")
+	UTween* StartReplicatedTween(UTween* Tween);
+
+	// UActorComponent interface
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	//~UActorComponent interface
+
+private:
+
+	UFUNCTION()
+	void OnRep_Descriptors();
+
+	/** Sent when the server stops a tween before it completes, so clients don't run on to the end value */
+	UFUNCTION(NetMulticast, Reliable)
+	void MulticastCorrectTarget(int32 Id, USceneComponent* Target, FTransform RelativeTransform);
+
+	void OnServerTweenComplete(int32 Id);
+
+	void StartLocalTween(const FTweenReplicatedDescriptor& Descriptor);
+
+	bool IsTweenActive(const UTween* Tween) const;
+
+	double GetServerWorldTimeSeconds() const;
+
+	/** Advances a just started tween by Seconds, through as many loops as that covers */
+	static void FastForward(UTween& Tween, float Seconds);
+
+	UPROPERTY(ReplicatedUsing = OnRep_Descriptors)
+	TArray<FTweenReplicatedDescriptor> Descriptors;
+
+	/** On the server the tween behind each descriptor, on clients the local copy being evaluated */
+	UPROPERTY()
+	TMap<int32, UTween*> Tweens;
+
+	int32 NextId = 0;
+};
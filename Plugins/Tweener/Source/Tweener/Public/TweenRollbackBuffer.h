@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UTween;
+
+/** Mutable state of one active tween, enough to put it back exactly as it was */
+struct FTweenSnapshotRecord
+{
+	UTween* Tween = nullptr;
+
+	FVector4 TargetValue;
+	FVector ValueOrigin;
+	FVector4f StartValue;
+	FVector4f EndValue;
+	FVector4f SpringVelocity;
+
+	float ElapsedTime = 0.f;
+	float Delay = 0.f;
+	float TimeScale = 1.f;
+	float PendingDeltaTime = 0.f;
+	float PendingUnscaledDeltaTime = 0.f;
+
+	int32 Loops = 0;
+
+	/** Active list the tween was in */
+	uint16 DomainIndex = 0;
+	uint8 TickGroup = 0;
+
+	uint8 LoopType = 0;
+
+	uint8 bIsRunningInReverse : 1;
+	uint8 bIsPaused : 1;
+	uint8 bIsSpringAsleep : 1;
+
+	FTweenSnapshotRecord()
+		: bIsRunningInReverse(false), bIsPaused(false), bIsSpringAsleep(false)
+	{
+	}
+
+	void Capture(UTween& InTween, uint8 InTickGroup, uint16 InDomainIndex);
+
+	void Restore() const;
+};
+
+/**
+ * Fixed size ring of per-frame tween snapshots for rollback. All storage is allocated up front by Initialize,
+ * capturing and restoring a frame only copies records.
+ */
+class TWEENER_API FTweenRollbackBuffer
+{
+public:
+
+	void Initialize(int32 InNumFrames, int32 InMaxTweensPerFrame);
+
+	bool IsInitialized() const { return Slots.Num() > 0; }
+
+	/** Claims Frame's slot, overwriting the oldest frame. Empty if NumRecords doesn't fit. */
+	TArrayView<FTweenSnapshotRecord> BeginCapture(int32 Frame, int32 NumRecords);
+
+	/** Records captured for Frame, if it is still in the ring */
+	bool Find(int32 Frame, TArrayView<const FTweenSnapshotRecord>& OutRecords) const;
+
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
+	SIZE_T GetAllocatedSize() const { return Slots.GetAllocatedSize() + Records.GetAllocatedSize(); }
+
+private:
+
+	struct FFrameSlot
+	{
+		int32 Frame = INDEX_NONE;
+		int32 NumRecords = 0;
+	};
+
+	int32 GetSlotIndex(int32 Frame) const;
+
+	TArray<FFrameSlot> Slots;
+
+	/** MaxTweensPerFrame records per slot */
+	TArray<FTweenSnapshotRecord> Records;
+
+	int32 MaxTweensPerFrame = 0;
+};
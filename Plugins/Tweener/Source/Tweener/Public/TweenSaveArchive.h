@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UTween;
+
+enum class ETweenSaveVersion : int32
+{
+	Initial = 1,
+
+	VersionPlusOne,
+	Latest = VersionPlusOne - 1
+};
+
+/**
+ * Fixed size record of one saved tween. Records are written and read as one block, so any change to the layout needs
+ * a new ETweenSaveVersion.
+ */
+struct FTweenSaveRecord
+{
+	enum EFlags : uint16
+	{
+		Active = 1 << 0,
+		RunningInReverse = 1 << 1,
+		Relative = 1 << 2,
+		Paused = 1 << 3,
+		TimeScaleIndependent = 1 << 4,
+		Spring = 1 << 5,
+		SpringAsleep = 1 << 6,
+		Cosmetic = 1 << 7,
+		SignificanceThrottled = 1 << 8,
+	};
+
+	/** Full values, whatever precision UTween keeps them at */
+	FVector4 TargetValue;
+	FVector4 StartValue;
+	FVector4 EndValue;
+	FVector4 SpringVelocity;
+
+	/** X1, Y1, X2, Y2 when EaseType is CubicBezier */
+	float CubicBezier[4];
+
+	float Duration;
+	float Delay;
+	float DelayBetweenLoops;
+	float ElapsedTime;
+	float TimeScale;
+	float SpringHalfLife;
+
+	int32 Loops;
+	int32 ParameterIndex;
+
+	/** Into the archive's target and name tables */
+	int32 TargetIndex;
+	int32 ParameterNameIndex;
+	int32 TimeDomainIndex;
+
+	/** Range of the archive's group table */
+	int32 FirstGroup;
+	int32 NumGroups;
+
+	/** Record of the tween chained after this one */
+	int32 NextRecord;
+
+	uint16 Flags;
+
+	uint8 TweenType;
+	uint8 TargetObjectType;
+	uint8 EaseType;
+	uint8 LoopType;
+	uint8 TickGroup;
+	uint8 Priority;
+};
+
+/**
+ * Compact, versioned binary form of a set of active tweens and the tweens chained after them, for save games.
+ * Targets are referenced by object path, so only tweens on objects that are found again by path after a load
+ * (placed actors and their components, assets) can be restored. Delegate bindings are not saved.
+ */
+class TWEENER_API FTweenSaveArchive
+{
+public:
+
+	/** Writes the tweens and their chains. Custom action tweens and tweens without a target are left out. */
+	static void Write(const TArray<UTween*>& ActiveTweens, TArray<uint8>& OutData);
+
+	/**
+	 * Recreates the tweens in Outer with their saved state. OutActiveTweens are the ones that were running, the rest
+	 * are reachable through their NextTween. Tweens whose target can't be found are dropped, ending their chain.
+	 */
+	static bool Read(const TArray<uint8>& Data, UObject* Outer, TArray<UTween*>& OutActiveTweens);
+};
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tween.h"
+#include "TweenSequence.generated.h"
+
+/** Loop state of one link of a chain as it was added, which HandleLooping counts down as the link plays */
+struct FTweenSequenceLoopSettings
+{
+	int32 Loops = 0;
+	float Delay = 0.f;
+	ELoopType LoopType = ELoopType::None;
+	bool bIsRunningInReverse = false;
+};
+
+USTRUCT()
+struct FTweenSequenceEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UTween* Tween = nullptr;
+
+	/** Link of Tween's NextTween chain that is currently running */
+	UPROPERTY()
+	UTween* ActiveTween = nullptr;
+
+	/** Time on the sequence's clock that the tween is activated */
+	UPROPERTY()
+	float StartTime = 0.f;
+
+	UPROPERTY()
+	bool bIsStarted = false;
+
+	UPROPERTY()
+	bool bIsFinished = false;
+
+	/** One per link of Tween's chain, restored each time the sequence starts */
+	TArray<FTweenSequenceLoopSettings> LoopSettings;
+};
+
+/**
+ * Schedules a set of tweens on one timeline. Tweens can be appended after each other, joined to run in parallel
+ * with the previous one, or inserted at an absolute time. The subsystem ticks the sequence as a single unit and
+ * Complete fires once every tween in it has finished.
+ */
+UCLASS(BlueprintType)
+class TWEENER_API UTweenSequence : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "Tween")
+	static UTweenSequence* CreateSequence(const UObject* WorldContextObject);
+
+	/** Starts the tween when everything added so far has finished */
+	UFUNCTION(BlueprintCallable)
+	UTweenSequence* Append(UTween* Tween);
+
+	/** Starts the tween at the same time as the previously added tween */
+	UFUNCTION(BlueprintCallable)
+	UTweenSequence* Join(UTween* Tween);
+
+	/** Starts the tween at Time seconds after the sequence starts */
+	UFUNCTION(BlueprintCallable)
+	UTweenSequence* Insert(float Time, UTween* Tween);
+
+	/** Pushes back the start of anything appended after this */
+	UFUNCTION(BlueprintCallable)
+	UTweenSequence* AppendInterval(float Interval);
+
+	UFUNCTION(BlueprintCallable)
+	UTweenSequence* SetTimeScaleIndependent();
+
+	/** Runs the sequence, and every tween in it, on the named clock. A running sequence moves over to it. */
+	UFUNCTION(BlueprintCallable)
+	UTweenSequence* SetTimeDomain(FName InTimeDomain);
+
+	/** Updates the sequence, and every tween in it, during InTickGroup. A running sequence moves over to it. */
+	UFUNCTION(BlueprintCallable)
+	UTweenSequence* SetTickGroup(ETickingGroup InTickGroup);
+
+	UFUNCTION(BlueprintCallable)
+	bool Stop(bool bBringToCompletion = false);
+
+	UFUNCTION(BlueprintCallable)
+	bool IsActive() const;
+
+	/** Time at which the last scheduled tween is expected to finish */
+	float GetDuration() const { return EndTime; }
+
+	bool ContainsTween(const UTween* Tween) const;
+
+	/** Resets the timeline so the sequence can be started (again) */
+	bool PrepareForUse();
+
+	/**
+	 * Advances the timeline, activating and ticking tweens as they come due. Returns true once every tween has finished.
+	 * @param bCompleteSequenceThisStep - brings every remaining tween to its end value
+	 */
+	bool Tick(float DeltaTime, float UnscaledDeltaTime, bool bCompleteSequenceThisStep = false);
+
+	// UBlueprintAsyncActionBase interface
+	virtual void Activate() override;
+	//~UBlueprintAsyncActionBase interface
+
+	UPROPERTY(BlueprintAssignable)
+	FTweenOutputPin Complete;
+	FTweenDelegate CompleteDelegate; // Non-dynamic version
+
+	UPROPERTY()
+	bool bIsPaused;
+
+	UPROPERTY()
+	bool bIsTimeScaleIndependent;
+
+	UPROPERTY()
+	TEnumAsByte<ETickingGroup> TickGroup = UTween::DefaultTickGroup;
+
+	UPROPERTY()
+	FName TimeDomain = TweenTimeDomain::Gameplay;
+
+private:
+
+	void AddEntry(UTween* Tween, float StartTime);
+
+	void TickEntry(FTweenSequenceEntry& Entry, float DeltaTime, float UnscaledDeltaTime, bool bCompleteTweenThisStep);
+
+	UPROPERTY()
+	TArray<FTweenSequenceEntry> Entries;
+
+	UPROPERTY()
+	float ElapsedTime;
+
+	/** End of the last tween added, where Append will start the next one */
+	float EndTime;
+
+	/** Start of the last tween added, where Join will start the next one */
+	float LastStartTime;
+
+	const UObject* WorldContextObject;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tween.h"
+
+class UWorld;
+class USceneComponent;
+class UWidget;
+
+/**
+ * Decides how often significance throttled tweens are updated, from whether their target was recently rendered,
+ * its distance to the closest player view and an optional user override. Thresholds come from the
+ * tweener.Significance.* cvars, which are flagged for scalability so they can be set per quality level.
+ */
+class FTweenSignificance
+{
+public:
+
+	static bool IsThrottledByDefault();
+
+	/**
+	 * Accumulates the tween's delta time and returns true when it is due an update, with DeltaTime and
+	 * UnscaledDeltaTime replaced by everything accumulated since the last one.
+	 */
+	bool ShouldUpdate(UTween& Tween, const UWorld& World, const FTweenSignificanceOverride& Override, float& DeltaTime, float& UnscaledDeltaTime);
+
+private:
+
+	ETweenSignificance Evaluate(const UTween& Tween, const UWorld& World, const FTweenSignificanceOverride& Override);
+
+	ETweenSignificance EvaluateSceneComponent(const USceneComponent& Component, const UWorld& World);
+
+	static ETweenSignificance EvaluateWidget(const UWidget& Widget);
+
+	void UpdateViewLocations(const UWorld& World);
+
+	/** Camera locations of the local players, refreshed once a frame */
+	TArray<FVector> ViewLocations;
+
+	uint64 ViewLocationsFrame = MAX_uint64;
+};
@@ -2,28 +2,175 @@
 
 #include "CoreMinimal.h"
 #include "Tween.h"
-#include "Subsystems/GameInstanceSubsystem.h"
-#include "Tickable.h"
+#include "TweenSequence.h"
+#include "TweenSignificance.h"
+#include "TweenRollbackBuffer.h"
+#include "TweenInstanceBatch.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/World.h"
 #include "TweenerSubsystem.generated.h"
 
 class UMaterialInstanceDynamic;
+class UTweenerSubsystem;
 
+/** Ticks the tweens of one ETickingGroup, registered on the persistent level of the subsystem's world */
+USTRUCT()
+struct FTweenerTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UTweenerSubsystem* Subsystem = nullptr;
+
+	// FTickFunction interface
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	//~FTickFunction interface
+};
+
+template<>
+struct TStructOpsTypeTraits<FTweenerTickFunction> : public TStructOpsTypeTraitsBase2<FTweenerTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/** Scale and pause state shared by every tween on one clock */
+USTRUCT()
+struct FTweenTimeDomainState
+{
+	GENERATED_BODY()
+
+	FName Name;
+
+	float TimeScale = 1.f;
+
+	bool bIsPaused = false;
+
+	/** Runs on real time rather than world time, so it keeps going while the game is paused or slowed */
+	bool bUsesRealTime = false;
+
+	/** Steps per second when the domain advances in fixed steps, 0 for variable steps */
+	int32 FixedStepRate = 0;
+
+	int32 MaxSubSteps = 8;
+
+	/** Only advanced by UTweenerSubsystem::AdvanceTimeDomain */
+	bool bIsManuallyStepped = false;
+
+	int32 PendingManualSteps = 0;
+
+	double FixedStepAccumulator = 0.0;
+
+	/** Fixed steps every tick group runs this frame */
+	int32 StepsThisFrame = 0;
+};
+
+/** Frame budget bookkeeping for one tick group's update */
+struct FTweenerTickContext
+{
+	double StartSeconds = 0.0;
+
+	double BudgetSeconds = 0.0;
+
+	double RemainingBudgetSeconds = 0.0;
+
+	bool bIsOutOfBudget = false;
+
+	int32 NumDeferredTweens = 0;
+};
+
+/** Tweens and sequences that share a tick group and a time domain */
+USTRUCT()
+struct FTweenerTweenList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<UTween*> ActiveTweens;
+
+	UPROPERTY()
+	TArray<UTweenSequence*> ActiveSequences;
+
+	/** Where the next tick starts walking ActiveTweens, so tweens deferred by the budget take turns */
+	int32 RoundRobinOffset = 0;
+
+	bool IsEmpty() const { return ActiveTweens.Num() == 0 && ActiveSequences.Num() == 0; }
+};
+
+/** Active tweens that were added to one group */
+USTRUCT()
+struct FTweenerGroupMembers
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<UTween*> Tweens;
+};
+
+/** Everything that updates in one tick group */
+USTRUCT()
+struct FTweenerTickGroup
+{
+	GENERATED_BODY()
+
+	/** Indexed by time domain */
+	UPROPERTY()
+	TArray<FTweenerTweenList> TimeDomains;
+
+	/** Stripped cosmetic tweens waiting for the group's next tick to complete, so callers can bind to them first */
+	UPROPERTY()
+	TArray<UTween*> PendingStrippedTweens;
+
+	float LastTickGameTimeSeconds = 0.f;
+
+	bool IsEmpty() const
+	{
+		if (PendingStrippedTweens.Num() > 0)
+		{
+			return false;
+		}
+
+		for (const FTweenerTweenList& TweenList : TimeDomains)
+		{
+			if (!TweenList.IsEmpty())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
 
 UCLASS()
-class TWEENER_API UTweenerSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+class TWEENER_API UTweenerSubsystem : public UWorldSubsystem
 {
 	GENERATED_BODY()
 	
 public:	
 	UTweenerSubsystem() {}
 
-	// FTickableGameObject begin
-	virtual UWorld* GetTickableGameObjectWorld() const override { return GetOuter()->GetWorld();}
-	virtual void Tick(float DeltaTime) override;
-	virtual ETickableTickType GetTickableTickType() const override;
-	virtual TStatId GetStatId() const override;
-	virtual bool IsTickableWhenPaused() const override { return true; }
-	// FTickableGameObject end
+	// USubsystem begin
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	// USubsystem end
+
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	// UWorldSubsystem begin
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	// UWorldSubsystem end
+
+	/** Replaces the built in significance checks of throttled tweens where it returns true, see UTween::SetSignificanceThrottled */
+	FTweenSignificanceOverride SignificanceOverride;
+
+	/** Updates the tweens and sequences that asked for this tick group */
+	void TickTweens(ETickingGroup Group);
+
+	/** Instance transforms queued by this world's tweens, committed at the end of each tick group */
+	FTweenInstanceBatch& GetInstanceBatch() { return InstanceBatch; }
 
 	UFUNCTION(BlueprintCallable, Category = "Tween Management")
 	bool StopTween(UTween* Tween, bool bBringToCompletion=false, bool bIncludeChain=false);
@@ -37,15 +184,123 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Tween Management")
 	void StopAllTweens(bool bBringToCompletion);
 
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	UTweenSequence* StartSequence(UTweenSequence* Sequence);
+
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	bool StopSequence(UTweenSequence* Sequence, bool bBringToCompletion = false);
+
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	bool IsSequenceActive(const UTweenSequence* Sequence) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Tween Management")
 	void SetAllTweenPauseState(bool bIsPaused);
 
 	UFUNCTION(BlueprintCallable, Category = "Tween Management")
 	bool IsTweenActive(const UTween* Tween) const;
 
+	/** Every running tween in every tick group and time domain, not including tweens waiting in a chain */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	void GetActiveTweens(TArray<UTween*>& OutTweens) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Tween Management")
 	bool ObjectHasActiveTweens(const UObject* Object) const ;
 
+	/** Pauses or resumes the active tweens in the group, see UTween::AddToGroup */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	void SetGroupPauseState(FName Group, bool bIsPaused);
+
+	/** Stops the active tweens in the group and returns how many there were */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	int32 StopGroup(FName Group, bool bBringToCompletion = false);
+
+	/** Sets the time scale of the active tweens in the group */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	void SetGroupTimeScale(FName Group, float TimeScale);
+
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	TArray<UTween*> GetGroupTweens(FName Group) const;
+
+	/** Adds a tween to a group, and to the group's members if it is running, see UTween::AddToGroup */
+	void AddTweenToGroup(UTween* Tween, FName Group);
+
+	/**
+	 * Adds a clock tweens can be put on with SetTimeDomain. Domains are also created on first use, running on world time.
+	 * @param bUsesRealTime - runs on real time, unaffected by world pause and time dilation, like TweenTimeDomain::UI
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	void RegisterTimeDomain(FName TimeDomain, bool bUsesRealTime = false);
+
+	/** Scales time for every tween in the domain */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	void SetTimeDomainScale(FName TimeDomain, float TimeScale);
+
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	float GetTimeDomainScale(FName TimeDomain) const;
+
+	/** Moves a tween to another tick group or time domain, taking it out of its old list if it is running */
+	void MoveTween(UTween* Tween, ETickingGroup TickGroup, FName TimeDomain);
+
+	/** Moves a sequence to another tick group or time domain, taking it out of its old list if it is running */
+	void MoveSequence(UTweenSequence* Sequence, ETickingGroup TickGroup, FName TimeDomain);
+
+	/** Pauses every tween in the domain without touching the tweens themselves */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	void SetTimeDomainPaused(FName TimeDomain, bool bIsPaused);
+
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	bool IsTimeDomainPaused(FName TimeDomain) const;
+
+	/**
+	 * Advances the domain in whole steps of 1 / StepsPerSecond, sub-stepping long frames, so its tweens give
+	 * bit-identical results for identical inputs whatever the frame rate. These tweens are never deferred by the budget
+	 * or throttled by significance.
+	 * @param StepsPerSecond - 0 returns the domain to variable steps
+	 * @param MaxSubSteps - most steps taken in one frame, time beyond it is dropped
+	 * @param bIsManuallyStepped - the domain only moves when stepped with AdvanceTimeDomain, for lockstep and replays
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	void SetTimeDomainFixedStep(FName TimeDomain, int32 StepsPerSecond, int32 MaxSubSteps = 8, bool bIsManuallyStepped = false);
+
+	/** Queues steps for a manually stepped fixed step domain, run on the next tick */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	void AdvanceTimeDomain(FName TimeDomain, int32 Steps = 1);
+
+	/**
+	 * Allocates the rollback ring, holding the state of up to MaxTweensPerFrame active tweens for each of the
+	 * last NumFrames captured frames. Sequences are not part of the snapshot.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	void InitializeRollback(int32 NumFrames, int32 MaxTweensPerFrame);
+
+	/** Records the state of every active tween for Frame. Fails if there are more than MaxTweensPerFrame. */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	bool CaptureSnapshot(int32 Frame);
+
+	/**
+	 * Puts the active tweens back as they were when Frame was captured, including tweens that have finished or
+	 * been stopped since. Targets pick up the restored state on their next update.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	bool RestoreSnapshot(int32 Frame);
+
+	/**
+	 * Writes every active tween, and the tweens chained after them, to a compact versioned archive for a save game.
+	 * Targets are referenced by path, delegate bindings and custom action tweens are not saved.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	void SaveActiveTweens(TArray<uint8>& OutData) const;
+
+	/**
+	 * Starts the tweens written by SaveActiveTweens again, picking up where they were saved. Call once the saved
+	 * targets have loaded. Returns the number of tweens started, or -1 if the data can't be read.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Tween Management")
+	int32 LoadActiveTweens(const TArray<uint8>& Data);
+
+	/** Logs the memory used by tweens in this world by target type, state and chain length, see tweener.memreport */
+	void DumpMemoryReport(FOutputDevice& Ar) const;
+
 	
 	UFUNCTION(BlueprintCallable, meta = ( WorldContext = "WorldContextObject", AdvancedDisplay = 4), Category = "Tween")
 	UTween* ComponentLocationTo(USceneComponent * SceneComponent, FVector Location, bool bIsLocationRelative = true, float Duration = 0.25f,
@@ -167,6 +422,43 @@ public:
 		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
 		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
 
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	UTween* InstanceLocationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Location, bool bIsLocationRelative = true, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	UTween* InstanceRelativeLocationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Location, bool bIsLocationRelative = true, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	UTween* InstanceRotationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FQuat Rotation, bool bIsRotationRelative = false, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	UTween* InstanceRelativeRotationTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FQuat Rotation, bool bIsRotationRelative = false, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	UTween* InstanceScaleTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Scale = FVector(1.0f, 1.0f, 1.0f), bool bIsScaleRelative = false, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 5), Category = "Tween")
+	UTween* InstanceRelativeScaleTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, FVector Scale = FVector(1.0f, 1.0f, 1.0f), bool bIsScaleRelative = false, float Duration = 0.25f,
+		EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject"), Category = "Tween")
+	UTween* ComponentPresetTo(USceneComponent* SceneComponent, const UTweenPreset* Preset, FTransform Target, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject"), Category = "Tween")
+	UTween* InstancePresetTo(UInstancedStaticMeshComponent* InstancedStaticMesh, int32 InstanceIndex, const UTweenPreset* Preset, FTransform Target,
+		const UObject* WorldContextObject = nullptr);
+
 	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 4), Category = "Tween")
 	UTween* WidgetSlotPositionTo(UWidget* Widget, FVector2D Location, bool bIsLocationRelative = false, float Duration = 0.25f,
 			EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
@@ -293,14 +585,112 @@ public:
 		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
 
 
+	/**
+	 * Bulk versions of the above. The tween for Targets[i] is delayed by i * StaggerDelay plus a random
+	 * [0, StaggerJitter) on top of any loop delay, and all tweens are started in a single pass.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 6), Category = "Tween")
+	TArray<UTween*> ComponentsLocationTo(const TArray<USceneComponent*>& SceneComponents, FVector Location, bool bIsLocationRelative = true, float Duration = 0.25f,
+		float StaggerDelay = 0.05f, float StaggerJitter = 0.0f, EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 6), Category = "Tween")
+	TArray<UTween*> ComponentsRotationTo(const TArray<USceneComponent*>& SceneComponents, FQuat Rotation, bool bIsRotationRelative = false, float Duration = 0.25f,
+		float StaggerDelay = 0.05f, float StaggerJitter = 0.0f, EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 6), Category = "Tween")
+	TArray<UTween*> ComponentsScaleTo(const TArray<USceneComponent*>& SceneComponents, FVector Scale = FVector(1.0f, 1.0f, 1.0f), bool bIsScaleRelative = false, float Duration = 0.25f,
+		float StaggerDelay = 0.05f, float StaggerJitter = 0.0f, EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 6), Category = "Tween")
+	TArray<UTween*> WidgetsRenderLocationTo(const TArray<UWidget*>& Widgets, FVector2D Location, bool bIsLocationRelative = false, float Duration = 0.25f,
+		float StaggerDelay = 0.05f, float StaggerJitter = 0.0f, EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 6), Category = "Tween")
+	TArray<UTween*> WidgetsRenderScaleTo(const TArray<UWidget*>& Widgets, FVector2D Scale = FVector2D(1.f,1.f), bool bIsScaleRelative = false, float Duration = 0.25f,
+		float StaggerDelay = 0.05f, float StaggerJitter = 0.0f, EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 6), Category = "Tween")
+	TArray<UTween*> WidgetsRenderOpacityTo(const TArray<UWidget*>& Widgets, float Opacity = 1.f, bool bIsOpacityRelative = false, float Duration = 0.25f,
+		float StaggerDelay = 0.05f, float StaggerJitter = 0.0f, EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", AdvancedDisplay = 6), Category = "Tween")
+	TArray<UTween*> WidgetsColorTo(const TArray<UWidget*>& Widgets, FLinearColor Color, bool bIsColorRelative = false, float Duration = 0.25f,
+		float StaggerDelay = 0.05f, float StaggerJitter = 0.0f, EEaseType EaseType = EEaseType::QuarticEaseIn, ELoopType LoopType = ELoopType::None,
+		int32 Loops = 0, float DelayBetweenLoops = 0.0f, const UObject* WorldContextObject = nullptr);
 
 private:
-	
 
+	/** Creates a tween per target with Factory and starts them all, reserving the storage up front */
+	template <typename TargetType, typename FactoryType>
+	TArray<UTween*> StartTweensStaggered(const TArray<TargetType*>& Targets, float StaggerDelay, float StaggerJitter, FactoryType Factory);
+
+	/** StartTween for a tween that is known not to be active yet */
+	bool StartNewTween(UTween* Tween);
+
+	/** Puts a prepared tween into its list, resetting the age and cost shown by the inspection commands */
+	void AddStartedTween(UTween* Tween, bool bMayAlreadyBeActive);
+
+	/** Queues a cosmetic tween that won't run here to be completed on its group's next tick */
+	void QueueStrippedTween(UTween* Tween);
+
+	/** Finishes a cosmetic tween that won't run here, firing its delegates and moving on to the rest of its chain */
+	void CompleteStrippedTween(UTween* Tween);
+
+	/** Per frame work done by the first tick group to run */
+	void BeginFrame();
+
+	/** One pass over a tick group's tweens and sequences in one time domain */
+	void TickTweenList(FTweenerTickGroup& TickGroup, int32 DomainIndex, float DeltaTime, float UnscaledDeltaTime, bool bIsFixedStep, FTweenerTickContext& Context);
+
+	FTweenerTickGroup& GetTickGroup(ETickingGroup Group);
+
+	FTweenerTweenList& GetTweenList(ETickingGroup Group, FName TimeDomain);
+
+	const FTweenerTweenList* FindTweenList(ETickingGroup Group, FName TimeDomain) const;
+
+	int32 FindOrAddTimeDomain(FName TimeDomain, bool bUsesRealTime = false);
+
+	void AddToGroupIndex(UTween* Tween);
+
+	void RemoveFromGroupIndex(UTween* Tween);
+
+	/** Makes sure the tick function for the group is registered and enabled */
+	void WakeTickGroup(ETickingGroup Group);
+
+	/** Indexed by ETickingGroup */
 	UPROPERTY()
-	TArray<UTween*> ActiveTweens;
+	TArray<FTweenerTickGroup> TickGroups;
+
+	/** Active tweens by group, kept in step with the active lists */
+	UPROPERTY()
+	TMap<FName, FTweenerGroupMembers> GroupMembers;
+
+	UPROPERTY()
+	TArray<FTweenTimeDomainState> TimeDomains;
+
+	TMap<FName, int32> TimeDomainIndices;
+
+	FTweenSignificance Significance;
+
+	FTweenRollbackBuffer RollbackBuffer;
+
+	FTweenInstanceBatch InstanceBatch;
+
+	/** Frame BeginFrame last ran for */
+	uint64 FrameCounter = MAX_uint64;
+
+	double BudgetUsedSeconds = 0.0;
+
+	bool bIsBudgetOverrun = false;
 
-	float LastTickGameTimeSeconds;
+	/** Indexed by ETickingGroup, a group's tick is only enabled while it has something to update */
+	TIndirectArray<FTweenerTickFunction> TickFunctions;
 	
 };
 
@@ -285,7 +285,8 @@ namespace AHEasing
 	{
 		if (p < 4.f / 11.f)
 		{
-			return (12.f * p * p) / 16.f;
+			// Tweener: upstream's 121/16, this copy had lost a digit and jumped from 0.1 to 1 at 4/11
+			return (121.f * p * p) / 16.f;
 		}
 		else if (p < 8.f / 11.f)
 		{
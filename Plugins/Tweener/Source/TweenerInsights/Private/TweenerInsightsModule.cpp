@@ -0,0 +1,61 @@
+#include "Features/IModularFeatures.h"
+#include "Insights/ITimingViewExtender.h"
+#include "Modules/ModuleManager.h"
+#include "TraceServices/ModuleService.h"
+#include "TweenerTimingViewExtender.h"
+#include "TweenerTraceAnalyzer.h"
+#include "TweenerTraceProvider.h"
+
+/** Registers the analysis of the Tweener trace channel with trace services */
+class FTweenerTraceModule : public TraceServices::IModule
+{
+public:
+
+	virtual void GetModuleInfo(TraceServices::FModuleInfo& OutModuleInfo) override
+	{
+		OutModuleInfo.Name = "TweenerTrace";
+		OutModuleInfo.DisplayName = TEXT("Tweener");
+	}
+
+	virtual void OnAnalysisBegin(TraceServices::IAnalysisSession& Session) override
+	{
+		const TSharedPtr<FTweenerTraceProvider> Provider = MakeShared<FTweenerTraceProvider>(Session);
+
+		Session.AddProvider(FTweenerTraceProvider::ProviderName, Provider);
+		Session.AddAnalyzer(new FTweenerTraceAnalyzer(Session, *Provider));
+	}
+
+	virtual void GetLoggers(TArray<const TCHAR*>& OutLoggers) override
+	{
+		OutLoggers.Add(TEXT("Tweener"));
+	}
+
+	virtual void GenerateReports(const TraceServices::IAnalysisSession& Session, const TCHAR* CmdLine, const TCHAR* OutputDirectory) override
+	{
+	}
+};
+
+class FTweenerInsightsModule : public IModuleInterface
+{
+public:
+
+	virtual void StartupModule() override
+	{
+		IModularFeatures::Get().RegisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+		IModularFeatures::Get().RegisterModularFeature(Insights::TimingViewExtenderFeatureName, &TimingViewExtender);
+	}
+
+	virtual void ShutdownModule() override
+	{
+		IModularFeatures::Get().UnregisterModularFeature(Insights::TimingViewExtenderFeatureName, &TimingViewExtender);
+		IModularFeatures::Get().UnregisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+	}
+
+private:
+
+	FTweenerTraceModule TraceModule;
+
+	FTweenerTimingViewExtender TimingViewExtender;
+};
+
+IMPLEMENT_MODULE(FTweenerInsightsModule, TweenerInsights)
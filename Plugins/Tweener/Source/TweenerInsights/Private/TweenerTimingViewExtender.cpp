@@ -0,0 +1,97 @@
+#include "TweenerTimingViewExtender.h"
+
+#include "TweenerTraceProvider.h"
+#include "Insights/ITimingViewSession.h"
+#include "Insights/ViewModels/ITimingViewDrawHelper.h"
+#include "Insights/ViewModels/TimingEventsTrack.h"
+#include "Insights/ViewModels/TimingTrackViewport.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+/** Lane per target, with a box per tween labelled with its channel and ease */
+class FTweenerTimingTrack : public FTimingEventsTrack
+{
+public:
+
+	explicit FTweenerTimingTrack(const TraceServices::IAnalysisSession& InAnalysisSession)
+		: FTimingEventsTrack(TEXT("Tweener"))
+		, AnalysisSession(InAnalysisSession)
+	{
+	}
+
+	virtual void BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context) override
+	{
+		TraceServices::FAnalysisSessionReadScope SessionReadScope(AnalysisSession);
+
+		const FTweenerTraceProvider* Provider = AnalysisSession.ReadProvider<FTweenerTraceProvider>(FTweenerTraceProvider::ProviderName);
+
+		if (!Provider)
+		{
+			return;
+		}
+
+		const FTimingTrackViewport& Viewport = Context.GetViewport();
+		const double EndOfSession = AnalysisSession.GetDurationSeconds();
+
+		SetNumLanes(Provider->GetNumTargets());
+
+		for (int32 TargetIndex = 0; TargetIndex < Provider->GetNumTargets(); ++TargetIndex)
+		{
+			const FTweenerTarget& Target = Provider->GetTarget(TargetIndex);
+
+			for (const FTweenerTimelineEvent& Event : Target.Events)
+			{
+				if (Event.StartTime > Viewport.GetEndTime())
+				{
+					break;
+				}
+
+				const double EndTime = FMath::Min(Event.EndTime, EndOfSession);
+
+				if (EndTime < Viewport.GetStartTime())
+				{
+					continue;
+				}
+
+				const FString Label = FString::Printf(TEXT("%s type %d ease %d %.2fs%s"), *Target.Name, Event.TweenType, Event.EaseType,
+					Event.Duration, Event.bWasStopped ? TEXT(" (stopped)") : TEXT(""));
+
+				Builder.AddEvent(Event.StartTime, EndTime, TargetIndex, *Label);
+			}
+		}
+	}
+
+private:
+
+	const TraceServices::IAnalysisSession& AnalysisSession;
+};
+
+void FTweenerTimingViewExtender::OnBeginSession(Insights::ITimingViewSession& InSession)
+{
+	Tracks.Add(&InSession, nullptr);
+}
+
+void FTweenerTimingViewExtender::OnEndSession(Insights::ITimingViewSession& InSession)
+{
+	Tracks.Remove(&InSession);
+}
+
+void FTweenerTimingViewExtender::Tick(Insights::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession)
+{
+	TSharedPtr<FTweenerTimingTrack>* Track = Tracks.Find(&InSession);
+
+	if (!Track || Track->IsValid())
+	{
+		return;
+	}
+
+	// only traces recorded with the Tweener channel get a track
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(InAnalysisSession);
+
+	const FTweenerTraceProvider* Provider = InAnalysisSession.ReadProvider<FTweenerTraceProvider>(FTweenerTraceProvider::ProviderName);
+
+	if (Provider && Provider->GetNumTargets() > 0)
+	{
+		*Track = MakeShared<FTweenerTimingTrack>(InAnalysisSession);
+		InSession.AddScrollableTrack(*Track);
+	}
+}
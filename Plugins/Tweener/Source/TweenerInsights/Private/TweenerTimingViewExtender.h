@@ -0,0 +1,20 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Insights/ITimingViewExtender.h"
+
+class FTweenerTimingTrack;
+
+/** Adds a Tweener track to the timing view, one lane per tweened target */
+class FTweenerTimingViewExtender : public Insights::ITimingViewExtender
+{
+public:
+
+	virtual void OnBeginSession(Insights::ITimingViewSession& InSession) override;
+	virtual void OnEndSession(Insights::ITimingViewSession& InSession) override;
+	virtual void Tick(Insights::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession) override;
+
+private:
+
+	TMap<Insights::ITimingViewSession*, TSharedPtr<FTweenerTimingTrack>> Tracks;
+};
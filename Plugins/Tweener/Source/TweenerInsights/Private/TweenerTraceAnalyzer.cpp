@@ -0,0 +1,65 @@
+#include "TweenerTraceAnalyzer.h"
+
+#include "TweenerTraceProvider.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+FTweenerTraceAnalyzer::FTweenerTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FTweenerTraceProvider& InProvider)
+	: Session(InSession)
+	, Provider(InProvider)
+{
+}
+
+void FTweenerTraceAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	FInterfaceBuilder& Builder = Context.InterfaceBuilder;
+
+	Builder.RouteEvent(RouteId_TweenStart, "Tweener", "TweenStart");
+	Builder.RouteEvent(RouteId_TweenChainAdvance, "Tweener", "TweenChainAdvance");
+	Builder.RouteEvent(RouteId_TweenLoop, "Tweener", "TweenLoop");
+	Builder.RouteEvent(RouteId_TweenStop, "Tweener", "TweenStop");
+	Builder.RouteEvent(RouteId_TweenComplete, "Tweener", "TweenComplete");
+}
+
+bool FTweenerTraceAnalyzer::OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context)
+{
+	TraceServices::FAnalysisSessionEditScope _(Session);
+
+	const FEventData& EventData = Context.EventData;
+
+	const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+	const uint64 TweenId = EventData.GetValue<uint64>("TweenId");
+
+	switch (RouteId)
+	{
+		case RouteId_TweenStart:
+		{
+			FString TargetName;
+			EventData.GetString("TargetName", TargetName);
+
+			Provider.OnTweenStart(Time, TweenId, EventData.GetValue<uint64>("TargetId"), TargetName,
+				EventData.GetValue<float>("Duration"), EventData.GetValue<int32>("Loops"),
+				EventData.GetValue<uint8>("TargetType"), EventData.GetValue<uint8>("TweenType"), EventData.GetValue<uint8>("EaseType"));
+			break;
+		}
+
+		// completion is traced before the chain advances and the next tween traces its own start, so a chain
+		// link only closes the tween if its completion was missed
+		case RouteId_TweenChainAdvance:
+		case RouteId_TweenComplete:
+			Provider.OnTweenEnd(Time, TweenId, false);
+			break;
+
+		case RouteId_TweenLoop:
+			Provider.OnTweenLoop(TweenId);
+			break;
+
+		case RouteId_TweenStop:
+			Provider.OnTweenEnd(Time, TweenId, true);
+			break;
+
+		default:
+			break;
+	}
+
+	return true;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Analyzer.h"
+
+class FTweenerTraceProvider;
+
+namespace TraceServices
+{
+	class IAnalysisSession;
+}
+
+/** Feeds the Tweener trace channel's events into FTweenerTraceProvider */
+class FTweenerTraceAnalyzer : public UE::Trace::IAnalyzer
+{
+public:
+
+	FTweenerTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FTweenerTraceProvider& InProvider);
+
+	virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override;
+	virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override;
+
+private:
+
+	enum : uint16
+	{
+		RouteId_TweenStart,
+		RouteId_TweenChainAdvance,
+		RouteId_TweenLoop,
+		RouteId_TweenStop,
+		RouteId_TweenComplete,
+	};
+
+	TraceServices::IAnalysisSession& Session;
+
+	FTweenerTraceProvider& Provider;
+};
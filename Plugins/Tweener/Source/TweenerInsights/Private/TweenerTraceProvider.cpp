@@ -0,0 +1,81 @@
+#include "TweenerTraceProvider.h"
+
+#include "TraceServices/Model/Counters.h"
+
+const FName FTweenerTraceProvider::ProviderName("TweenerTraceProvider");
+
+FTweenerTraceProvider::FTweenerTraceProvider(TraceServices::IAnalysisSession& InSession)
+	: Session(InSession)
+{
+}
+
+void FTweenerTraceProvider::OnTweenStart(double Time, uint64 TweenId, uint64 TargetId, const FString& TargetName, float Duration, int32 Loops, uint8 TargetType, uint8 TweenType, uint8 EaseType)
+{
+	Session.WriteAccessCheck();
+
+	// addresses are reused once a target is destroyed, a new path means a new target
+	int32* TargetIndex = TargetIndices.Find(TargetId);
+
+	if (!TargetIndex || Targets[*TargetIndex].Name != TargetName)
+	{
+		FTweenerTarget& Target = Targets.AddDefaulted_GetRef();
+		Target.Name = TargetName.IsEmpty() ? FString::Printf(TEXT("0x%llx"), TargetId) : TargetName;
+
+		TargetIndex = &TargetIndices.Add(TargetId, Targets.Num() - 1);
+	}
+
+	FTweenerTimelineEvent& Event = Targets[*TargetIndex].Events.AddDefaulted_GetRef();
+	Event.StartTime = Time;
+	Event.TweenId = TweenId;
+	Event.Duration = Duration;
+	Event.Loops = Loops;
+	Event.TargetType = TargetType;
+	Event.TweenType = TweenType;
+	Event.EaseType = EaseType;
+
+	ActiveEvents.Add(TweenId, TPair<int32, int32>(*TargetIndex, Targets[*TargetIndex].Events.Num() - 1));
+
+	if (!ActiveTweensCounter)
+	{
+		ActiveTweensCounter = TraceServices::EditCounterProvider(Session).CreateEditableCounter();
+		ActiveTweensCounter->SetName(TEXT("Tweener/Active Tweens"));
+		ActiveTweensCounter->SetIsFloatingPoint(false);
+	}
+
+	ActiveTweensCounter->SetValue(Time, ActiveEvents.Num());
+
+	Session.UpdateDurationSeconds(Time);
+}
+
+void FTweenerTraceProvider::OnTweenLoop(uint64 TweenId)
+{
+	Session.WriteAccessCheck();
+
+	if (const TPair<int32, int32>* Active = ActiveEvents.Find(TweenId))
+	{
+		++Targets[Active->Key].Events[Active->Value].NumLoopsCompleted;
+	}
+}
+
+void FTweenerTraceProvider::OnTweenEnd(double Time, uint64 TweenId, bool bWasStopped)
+{
+	Session.WriteAccessCheck();
+
+	TPair<int32, int32> Active;
+
+	if (!ActiveEvents.RemoveAndCopyValue(TweenId, Active))
+	{
+		return;
+	}
+
+	FTweenerTimelineEvent& Event = Targets[Active.Key].Events[Active.Value];
+	Event.EndTime = Time;
+	Event.bWasStopped = bWasStopped;
+
+	if (ActiveTweensCounter)
+	{
+		ActiveTweensCounter->SetValue(Time, ActiveEvents.Num());
+	}
+
+	Session.UpdateDurationSeconds(Time);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+namespace TraceServices
+{
+	class IEditableCounter;
+}
+
+/** One tween's time on its target, from start until it completes, is stopped or hands over to its chain */
+struct FTweenerTimelineEvent
+{
+	double StartTime = 0.0;
+
+	/** Still running at the end of the trace while this is infinity */
+	double EndTime = TNumericLimits<double>::Max();
+
+	uint64 TweenId = 0;
+
+	float Duration = 0.f;
+
+	int32 Loops = 0;
+	int32 NumLoopsCompleted = 0;
+
+	uint8 TargetType = 0;
+	uint8 TweenType = 0;
+	uint8 EaseType = 0;
+
+	bool bWasStopped = false;
+};
+
+struct FTweenerTarget
+{
+	FString Name;
+
+	/** Sorted by start time */
+	TArray<FTweenerTimelineEvent> Events;
+};
+
+/** Tween lifecycles from the Tweener trace channel, grouped by target, plus an Active Tweens counter */
+class FTweenerTraceProvider : public TraceServices::IProvider
+{
+public:
+
+	static const FName ProviderName;
+
+	explicit FTweenerTraceProvider(TraceServices::IAnalysisSession& InSession);
+
+	void OnTweenStart(double Time, uint64 TweenId, uint64 TargetId, const FString& TargetName, float Duration, int32 Loops, uint8 TargetType, uint8 TweenType, uint8 EaseType);
+	void OnTweenLoop(uint64 TweenId);
+	void OnTweenEnd(double Time, uint64 TweenId, bool bWasStopped);
+
+	int32 GetNumTargets() const { return Targets.Num(); }
+
+	const FTweenerTarget& GetTarget(int32 Index) const { return Targets[Index]; }
+
+private:
+
+	TraceServices::IAnalysisSession& Session;
+
+	TraceServices::IEditableCounter* ActiveTweensCounter = nullptr;
+
+	TArray<FTweenerTarget> Targets;
+	TMap<uint64, int32> TargetIndices;
+
+	/** Running tweens, by id, to their target and event */
+	TMap<uint64, TPair<int32, int32>> ActiveEvents;
+};
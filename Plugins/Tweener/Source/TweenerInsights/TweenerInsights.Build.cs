@@ -0,0 +1,21 @@
+using UnrealBuildTool;
+
+public class TweenerInsights : ModuleRules
+{
+	public TweenerInsights(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"Slate",
+				"SlateCore",
+				"TraceAnalysis",
+				"TraceServices",
+				"TraceInsights",
+			}
+			);
+	}
+}
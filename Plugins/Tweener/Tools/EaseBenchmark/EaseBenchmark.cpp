@@ -0,0 +1,688 @@
+// Standalone throughput and accuracy harness for the eases behind UTween::Ease. No engine dependency, build with e.g.
+//
+//   c++ -O2 -std=c++17 -msse2 -I../../Source/Tweener/ThirdParty/AHEasing EaseBenchmark.cpp ../../Source/Tweener/ThirdParty/AHEasing/AHEasing/easing.cpp -o EaseBenchmark
+//   ./EaseBenchmark [--samples N] [--repeats N] [--lut-size N] [--json path]
+//
+// Every ease is measured as
+//   scalar  - the shipping path, AHEasing through the same switch as EaseHelper in Tween.cpp
+//   batched - one ease over a whole array, inlined so the compiler can unroll and vectorise
+//   simd    - hand written SSE, only for eases without transcendentals
+//   lut     - table built from the reference and lerped, like FTweenCubicBezierCurve
+// and compared against the same curves evaluated in double precision.
+// Cubic bezier is left out, it is a table already.
+//
+// The reference is written from the curves' definitions rather than copied from AHEasing, so a shipping ease that
+// drifts from its definition shows up as a scalar error well above float rounding. Any such ease is listed after the
+// table and the tool exits with 2. Expect the lut to do worst where a curve has a corner or a vertical tangent, the
+// bounces and circular eases, as lerping between samples cuts across those.
+
+#include "AHEasing/easing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define EASE_BENCHMARK_SSE 1
+#else
+#define EASE_BENCHMARK_SSE 0
+#endif
+
+namespace
+{
+	/** Same order as EEaseType, minus CubicBezier */
+	enum class EEase : int
+	{
+		Linear,
+		QuadraticEaseIn,
+		QuadraticEaseOut,
+		QuadraticEaseInOut,
+		CubicEaseIn,
+		CubicEaseOut,
+		CubicEaseInOut,
+		QuarticEaseIn,
+		QuarticEaseOut,
+		QuarticEaseInOut,
+		QuinticEaseIn,
+		QuinticEaseOut,
+		QuinticEaseInOut,
+		SineEaseIn,
+		SineEaseOut,
+		SineEaseInOut,
+		CircularEaseIn,
+		CircularEaseOut,
+		CircularEaseInOut,
+		ExponentialEaseIn,
+		ExponentialEaseOut,
+		ExponentialEaseInOut,
+		ElasticEaseIn,
+		ElasticEaseOut,
+		ElasticEaseInOut,
+		BackEaseIn,
+		BackEaseOut,
+		BackEaseInOut,
+		BounceEaseIn,
+		BounceEaseOut,
+		BounceEaseInOut,
+		Punch,
+
+		Count
+	};
+
+	const char* const EaseNames[] =
+	{
+		"Linear",
+		"QuadraticEaseIn", "QuadraticEaseOut", "QuadraticEaseInOut",
+		"CubicEaseIn", "CubicEaseOut", "CubicEaseInOut",
+		"QuarticEaseIn", "QuarticEaseOut", "QuarticEaseInOut",
+		"QuinticEaseIn", "QuinticEaseOut", "QuinticEaseInOut",
+		"SineEaseIn", "SineEaseOut", "SineEaseInOut",
+		"CircularEaseIn", "CircularEaseOut", "CircularEaseInOut",
+		"ExponentialEaseIn", "ExponentialEaseOut", "ExponentialEaseInOut",
+		"ElasticEaseIn", "ElasticEaseOut", "ElasticEaseInOut",
+		"BackEaseIn", "BackEaseOut", "BackEaseInOut",
+		"BounceEaseIn", "BounceEaseOut", "BounceEaseInOut",
+		"Punch",
+	};
+
+	static_assert(sizeof(EaseNames) / sizeof(EaseNames[0]) == static_cast<int>(EEase::Count), "EaseNames is out of step with EEase");
+
+	/** Copy of EaseElasticPunch in Tween.cpp */
+	float EaseElasticPunch(float Value)
+	{
+		if (std::fabs(Value) <= 1.e-8f || std::fabs(Value - 1.f) <= 1.e-8f)
+		{
+			return 0.f;
+		}
+
+		const float p = 0.3f;
+		return std::pow(2.f, -10.f * Value) * std::sin(Value * (2.f * 3.1415926535897932f) / p);
+	}
+
+	/** Copy of EaseHelper in Tween.cpp */
+	float EaseHelper(float Value, EEase Type)
+	{
+		using namespace AHEasing;
+
+		switch (Type)
+		{
+			default:
+			case EEase::Linear: return Value;
+			case EEase::QuadraticEaseIn: return QuadraticEaseIn(Value);
+			case EEase::QuadraticEaseOut: return QuadraticEaseOut(Value);
+			case EEase::QuadraticEaseInOut: return QuadraticEaseInOut(Value);
+			case EEase::CubicEaseIn: return CubicEaseIn(Value);
+			case EEase::CubicEaseOut: return CubicEaseOut(Value);
+			case EEase::CubicEaseInOut: return CubicEaseInOut(Value);
+			case EEase::QuarticEaseIn: return QuarticEaseIn(Value);
+			case EEase::QuarticEaseOut: return QuarticEaseOut(Value);
+			case EEase::QuarticEaseInOut: return QuarticEaseInOut(Value);
+			case EEase::QuinticEaseIn: return QuinticEaseIn(Value);
+			case EEase::QuinticEaseOut: return QuinticEaseOut(Value);
+			case EEase::QuinticEaseInOut: return QuinticEaseInOut(Value);
+			case EEase::SineEaseIn: return SineEaseIn(Value);
+			case EEase::SineEaseOut: return SineEaseOut(Value);
+			case EEase::SineEaseInOut: return SineEaseInOut(Value);
+			case EEase::CircularEaseIn: return CircularEaseIn(Value);
+			case EEase::CircularEaseOut: return CircularEaseOut(Value);
+			case EEase::CircularEaseInOut: return CircularEaseInOut(Value);
+			case EEase::ExponentialEaseIn: return ExponentialEaseIn(Value);
+			case EEase::ExponentialEaseOut: return ExponentialEaseOut(Value);
+			case EEase::ExponentialEaseInOut: return ExponentialEaseInOut(Value);
+			case EEase::ElasticEaseIn: return ElasticEaseIn(Value);
+			case EEase::ElasticEaseOut: return ElasticEaseOut(Value);
+			case EEase::ElasticEaseInOut: return ElasticEaseInOut(Value);
+			case EEase::BackEaseIn: return BackEaseIn(Value);
+			case EEase::BackEaseOut: return BackEaseOut(Value);
+			case EEase::BackEaseInOut: return BackEaseInOut(Value);
+			case EEase::BounceEaseIn: return BounceEaseIn(Value);
+			case EEase::BounceEaseOut: return BounceEaseOut(Value);
+			case EEase::BounceEaseInOut: return BounceEaseInOut(Value);
+			case EEase::Punch: return EaseElasticPunch(Value);
+		}
+	}
+
+	/**
+	 * The AHEasing curves written once for any precision. Instantiated with double it is the reference, with float it is
+	 * the batched variant. The formulas match easing.cpp exactly, so the reference measures precision, not intent.
+	 */
+	template <typename T>
+	struct TEaseCurves
+	{
+		static constexpr T Pi = T(3.14159265358979323846);
+		static constexpr T HalfPi = Pi / T(2);
+
+		static T BounceOut(T p)
+		{
+			if (p < T(4) / T(11))
+			{
+				return (T(121) * p * p) / T(16);
+			}
+			else if (p < T(8) / T(11))
+			{
+				return (T(363) / T(40) * p * p) - (T(99) / T(10) * p) + T(17) / T(5);
+			}
+			else if (p < T(9) / T(10))
+			{
+				return (T(4356) / T(361) * p * p) - (T(35442) / T(1805) * p) + T(16061) / T(1805);
+			}
+
+			return (T(54) / T(5) * p * p) - (T(513) / T(25) * p) + T(268) / T(25);
+		}
+
+		static T BackIn(T p)
+		{
+			return p * p * p - p * std::sin(p * Pi);
+		}
+
+		template <EEase Type>
+		static T Evaluate(T p)
+		{
+			switch (Type)
+			{
+				case EEase::Linear: return p;
+				case EEase::QuadraticEaseIn: return p * p;
+				case EEase::QuadraticEaseOut: return -(p * (p - T(2)));
+				case EEase::QuadraticEaseInOut: return p < T(0.5) ? T(2) * p * p : (T(-2) * p * p) + (T(4) * p) - T(1);
+				case EEase::CubicEaseIn: return p * p * p;
+				case EEase::CubicEaseOut: { const T f = p - T(1); return f * f * f + T(1); }
+				case EEase::CubicEaseInOut: { const T f = T(2) * p - T(2); return p < T(0.5) ? T(4) * p * p * p : T(0.5) * f * f * f + T(1); }
+				case EEase::QuarticEaseIn: return p * p * p * p;
+				case EEase::QuarticEaseOut: { const T f = p - T(1); return f * f * f * (T(1) - p) + T(1); }
+				case EEase::QuarticEaseInOut: { const T f = p - T(1); return p < T(0.5) ? T(8) * p * p * p * p : T(-8) * f * f * f * f + T(1); }
+				case EEase::QuinticEaseIn: return p * p * p * p * p;
+				case EEase::QuinticEaseOut: { const T f = p - T(1); return f * f * f * f * f + T(1); }
+				case EEase::QuinticEaseInOut: { const T f = T(2) * p - T(2); return p < T(0.5) ? T(16) * p * p * p * p * p : T(0.5) * f * f * f * f * f + T(1); }
+				case EEase::SineEaseIn: return std::sin((p - T(1)) * HalfPi) + T(1);
+				case EEase::SineEaseOut: return std::sin(p * HalfPi);
+				case EEase::SineEaseInOut: return T(0.5) * (T(1) - std::cos(p * Pi));
+				case EEase::CircularEaseIn: return T(1) - std::sqrt(T(1) - p * p);
+				case EEase::CircularEaseOut: return std::sqrt((T(2) - p) * p);
+				case EEase::CircularEaseInOut:
+					return p < T(0.5)
+						? T(0.5) * (T(1) - std::sqrt(T(1) - T(4) * (p * p)))
+						: T(0.5) * (std::sqrt(-((T(2) * p) - T(3)) * ((T(2) * p) - T(1))) + T(1));
+				case EEase::ExponentialEaseIn: return p == T(0) ? p : std::pow(T(2), T(10) * (p - T(1)));
+				case EEase::ExponentialEaseOut: return p == T(1) ? p : T(1) - std::pow(T(2), T(-10) * p);
+				case EEase::ExponentialEaseInOut:
+					if (p == T(0) || p == T(1))
+					{
+						return p;
+					}
+					return p < T(0.5) ? T(0.5) * std::pow(T(2), T(20) * p - T(10)) : T(-0.5) * std::pow(T(2), T(-20) * p + T(10)) + T(1);
+				case EEase::ElasticEaseIn: return std::sin(T(13) * HalfPi * p) * std::pow(T(2), T(10) * (p - T(1)));
+				case EEase::ElasticEaseOut: return std::sin(T(-13) * HalfPi * (p + T(1))) * std::pow(T(2), T(-10) * p) + T(1);
+				case EEase::ElasticEaseInOut:
+					return p < T(0.5)
+						? T(0.5) * std::sin(T(13) * HalfPi * (T(2) * p)) * std::pow(T(2), T(10) * ((T(2) * p) - T(1)))
+						: T(0.5) * (std::sin(T(-13) * HalfPi * ((T(2) * p - T(1)) + T(1))) * std::pow(T(2), T(-10) * (T(2) * p - T(1))) + T(2));
+				case EEase::BackEaseIn: return BackIn(p);
+				case EEase::BackEaseOut: return T(1) - BackIn(T(1) - p);
+				case EEase::BackEaseInOut: return p < T(0.5) ? T(0.5) * BackIn(T(2) * p) : T(0.5) * (T(1) - BackIn(T(1) - (T(2) * p - T(1)))) + T(0.5);
+				case EEase::BounceEaseIn: return T(1) - BounceOut(T(1) - p);
+				case EEase::BounceEaseOut: return BounceOut(p);
+				case EEase::BounceEaseInOut: return p < T(0.5) ? T(0.5) * (T(1) - BounceOut(T(1) - p * T(2))) : T(0.5) * BounceOut(p * T(2) - T(1)) + T(0.5);
+				case EEase::Punch:
+					if (p == T(0) || p == T(1))
+					{
+						return T(0);
+					}
+					return std::pow(T(2), T(-10) * p) * std::sin(p * (T(2) * Pi) / T(0.3));
+				default: return p;
+			}
+		}
+	};
+
+	template <typename T, int Index = 0>
+	T EvaluateCurve(EEase Type, T p)
+	{
+		if constexpr (Index < static_cast<int>(EEase::Count))
+		{
+			return static_cast<int>(Type) == Index
+				? TEaseCurves<T>::template Evaluate<static_cast<EEase>(Index)>(p)
+				: EvaluateCurve<T, Index + 1>(Type, p);
+		}
+		else
+		{
+			return p;
+		}
+	}
+
+	using FBatchFunction = void (*)(const float*, float*, size_t);
+
+	template <EEase Type>
+	void EvaluateBatch(const float* In, float* Out, size_t Num)
+	{
+		for (size_t Index = 0; Index < Num; ++Index)
+		{
+			Out[Index] = TEaseCurves<float>::Evaluate<Type>(In[Index]);
+		}
+	}
+
+	template <int... Indices>
+	const FBatchFunction* MakeBatchTable(std::integer_sequence<int, Indices...>)
+	{
+		static const FBatchFunction Table[] = { &EvaluateBatch<static_cast<EEase>(Indices)>... };
+		return Table;
+	}
+
+	const FBatchFunction* const BatchFunctions = MakeBatchTable(std::make_integer_sequence<int, static_cast<int>(EEase::Count)>());
+
+#if EASE_BENCHMARK_SSE
+	inline __m128 Select(__m128 Mask, __m128 A, __m128 B)
+	{
+		return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B));
+	}
+
+	inline __m128 BounceOut4(__m128 p)
+	{
+		const __m128 p2 = _mm_mul_ps(p, p);
+
+		const __m128 A = _mm_div_ps(_mm_mul_ps(_mm_set1_ps(121.f), p2), _mm_set1_ps(16.f));
+		const __m128 B = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(363.f / 40.f), p2), _mm_mul_ps(_mm_set1_ps(99.f / 10.f), p)), _mm_set1_ps(17.f / 5.f));
+		const __m128 C = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(4356.f / 361.f), p2), _mm_mul_ps(_mm_set1_ps(35442.f / 1805.f), p)), _mm_set1_ps(16061.f / 1805.f));
+		const __m128 D = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(54.f / 5.f), p2), _mm_mul_ps(_mm_set1_ps(513.f / 25.f), p)), _mm_set1_ps(268.f / 25.f));
+
+		__m128 Result = D;
+		Result = Select(_mm_cmplt_ps(p, _mm_set1_ps(9.f / 10.f)), C, Result);
+		Result = Select(_mm_cmplt_ps(p, _mm_set1_ps(8.f / 11.f)), B, Result);
+		return Select(_mm_cmplt_ps(p, _mm_set1_ps(4.f / 11.f)), A, Result);
+	}
+
+	/** Four lanes at a time. Returns false for eases that need sin, cos or pow, which SSE doesn't have. */
+	bool EvaluateSimd4(EEase Type, __m128 p, __m128& Out)
+	{
+		const __m128 One = _mm_set1_ps(1.f);
+		const __m128 Half = _mm_set1_ps(0.5f);
+		const __m128 Two = _mm_set1_ps(2.f);
+		const __m128 IsLow = _mm_cmplt_ps(p, Half);
+
+		const __m128 p2 = _mm_mul_ps(p, p);
+		const __m128 f = _mm_sub_ps(p, One);
+		const __m128 f2 = _mm_mul_ps(f, f);
+		const __m128 g = _mm_sub_ps(_mm_mul_ps(Two, p), Two);
+		const __m128 g2 = _mm_mul_ps(g, g);
+
+		switch (Type)
+		{
+			case EEase::Linear: Out = p; return true;
+			case EEase::QuadraticEaseIn: Out = p2; return true;
+			case EEase::QuadraticEaseOut: Out = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(p, _mm_sub_ps(p, Two))); return true;
+			case EEase::QuadraticEaseInOut:
+				Out = Select(IsLow, _mm_mul_ps(Two, p2), _mm_sub_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(-2.f), p2), _mm_mul_ps(_mm_set1_ps(4.f), p)), One));
+				return true;
+			case EEase::CubicEaseIn: Out = _mm_mul_ps(p2, p); return true;
+			case EEase::CubicEaseOut: Out = _mm_add_ps(_mm_mul_ps(f2, f), One); return true;
+			case EEase::CubicEaseInOut:
+				Out = Select(IsLow, _mm_mul_ps(_mm_set1_ps(4.f), _mm_mul_ps(p2, p)), _mm_add_ps(_mm_mul_ps(Half, _mm_mul_ps(g2, g)), One));
+				return true;
+			case EEase::QuarticEaseIn: Out = _mm_mul_ps(p2, p2); return true;
+			case EEase::QuarticEaseOut: Out = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(f2, f), _mm_sub_ps(One, p)), One); return true;
+			case EEase::QuarticEaseInOut:
+				Out = Select(IsLow, _mm_mul_ps(_mm_set1_ps(8.f), _mm_mul_ps(p2, p2)), _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-8.f), _mm_mul_ps(f2, f2)), One));
+				return true;
+			case EEase::QuinticEaseIn: Out = _mm_mul_ps(_mm_mul_ps(p2, p2), p); return true;
+			case EEase::QuinticEaseOut: Out = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(f2, f2), f), One); return true;
+			case EEase::QuinticEaseInOut:
+				Out = Select(IsLow, _mm_mul_ps(_mm_set1_ps(16.f), _mm_mul_ps(_mm_mul_ps(p2, p2), p)), _mm_add_ps(_mm_mul_ps(Half, _mm_mul_ps(_mm_mul_ps(g2, g2), g)), One));
+				return true;
+			case EEase::CircularEaseIn: Out = _mm_sub_ps(One, _mm_sqrt_ps(_mm_sub_ps(One, p2))); return true;
+			case EEase::CircularEaseOut: Out = _mm_sqrt_ps(_mm_mul_ps(_mm_sub_ps(Two, p), p)); return true;
+			case EEase::CircularEaseInOut:
+			{
+				const __m128 Low = _mm_mul_ps(Half, _mm_sub_ps(One, _mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(One, _mm_mul_ps(_mm_set1_ps(4.f), p2))))));
+				const __m128 TwoP = _mm_mul_ps(Two, p);
+				const __m128 High = _mm_mul_ps(Half, _mm_add_ps(_mm_sqrt_ps(_mm_max_ps(_mm_setzero_ps(),
+					_mm_mul_ps(_mm_sub_ps(_mm_set1_ps(3.f), TwoP), _mm_sub_ps(TwoP, One)))), One));
+				Out = Select(IsLow, Low, High);
+				return true;
+			}
+			case EEase::BounceEaseIn: Out = _mm_sub_ps(One, BounceOut4(_mm_sub_ps(One, p))); return true;
+			case EEase::BounceEaseOut: Out = BounceOut4(p); return true;
+			case EEase::BounceEaseInOut:
+			{
+				const __m128 TwoP = _mm_mul_ps(Two, p);
+				const __m128 Low = _mm_mul_ps(Half, _mm_sub_ps(One, BounceOut4(_mm_sub_ps(One, TwoP))));
+				const __m128 High = _mm_add_ps(_mm_mul_ps(Half, BounceOut4(_mm_sub_ps(TwoP, One))), Half);
+				Out = Select(IsLow, Low, High);
+				return true;
+			}
+			default:
+				return false;
+		}
+	}
+
+	bool EvaluateSimd(EEase Type, const float* In, float* Out, size_t Num)
+	{
+		size_t Index = 0;
+
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			__m128 Result;
+
+			if (!EvaluateSimd4(Type, _mm_loadu_ps(In + Index), Result))
+			{
+				return false;
+			}
+
+			_mm_storeu_ps(Out + Index, Result);
+		}
+
+		for (; Index < Num; ++Index)
+		{
+			Out[Index] = EvaluateCurve<float>(Type, In[Index]);
+		}
+
+		return true;
+	}
+#else
+	bool EvaluateSimd(EEase, const float*, float*, size_t)
+	{
+		return false;
+	}
+#endif
+
+	/** Curve sampled from the double reference at evenly spaced points and linearly interpolated */
+	struct FLookupTable
+	{
+		std::vector<float> Samples;
+
+		FLookupTable(EEase Type, int NumSamples)
+		{
+			Samples.resize(NumSamples);
+
+			for (int Index = 0; Index < NumSamples; ++Index)
+			{
+				Samples[Index] = static_cast<float>(EvaluateCurve<double>(Type, static_cast<double>(Index) / (NumSamples - 1)));
+			}
+		}
+
+		float Evaluate(float Alpha) const
+		{
+			const int NumSamples = static_cast<int>(Samples.size());
+			const float Position = std::fmin(std::fmax(Alpha, 0.f), 1.f) * (NumSamples - 1);
+			const int Index = std::min(static_cast<int>(Position), NumSamples - 2);
+			const float Fraction = Position - Index;
+			return Samples[Index] + (Samples[Index + 1] - Samples[Index]) * Fraction;
+		}
+	};
+
+	struct FVariantResult
+	{
+		bool bIsAvailable = false;
+		double NsPerSample = 0.0;
+		double MaxError = 0.0;
+		double MeanError = 0.0;
+	};
+
+	struct FEaseResult
+	{
+		EEase Type;
+		FVariantResult Scalar;
+		FVariantResult Batched;
+		FVariantResult Simd;
+		FVariantResult Lut;
+	};
+
+	struct FOptions
+	{
+		size_t NumSamples = 1 << 20;
+		int NumRepeats = 10;
+		int LutSize = 256;
+		std::string JsonPath;
+	};
+
+	volatile float GSink = 0.f;
+
+	/** Best of NumRepeats, so a context switch doesn't count against a variant */
+	template <typename FunctionType>
+	double MeasureNsPerSample(const FOptions& Options, const std::vector<float>& In, std::vector<float>& Out, FunctionType Function)
+	{
+		double BestSeconds = 1.e30;
+
+		for (int Repeat = 0; Repeat < Options.NumRepeats; ++Repeat)
+		{
+			const auto Start = std::chrono::steady_clock::now();
+			Function(In.data(), Out.data(), In.size());
+			const auto End = std::chrono::steady_clock::now();
+
+			GSink = GSink + Out[Repeat % Out.size()];
+
+			BestSeconds = std::min(BestSeconds, std::chrono::duration<double>(End - Start).count());
+		}
+
+		return BestSeconds * 1.e9 / In.size();
+	}
+
+	void MeasureError(const std::vector<double>& Reference, const std::vector<float>& Out, FVariantResult& Result)
+	{
+		double Sum = 0.0;
+
+		for (size_t Index = 0; Index < Out.size(); ++Index)
+		{
+			const double Error = std::fabs(static_cast<double>(Out[Index]) - Reference[Index]);
+			Result.MaxError = std::max(Result.MaxError, Error);
+			Sum += Error;
+		}
+
+		Result.MeanError = Sum / Out.size();
+	}
+
+	FEaseResult MeasureEase(EEase Type, const FOptions& Options, const std::vector<float>& RandomInputs, const std::vector<float>& GridInputs)
+	{
+		FEaseResult Result;
+		Result.Type = Type;
+
+		std::vector<double> Reference(GridInputs.size());
+
+		for (size_t Index = 0; Index < GridInputs.size(); ++Index)
+		{
+			Reference[Index] = EvaluateCurve<double>(Type, static_cast<double>(GridInputs[Index]));
+		}
+
+		std::vector<float> Out(RandomInputs.size());
+		std::vector<float> GridOut(GridInputs.size());
+
+		const auto Scalar = [Type](const float* In, float* Output, size_t Num)
+		{
+			for (size_t Index = 0; Index < Num; ++Index)
+			{
+				Output[Index] = EaseHelper(In[Index], Type);
+			}
+		};
+
+		Result.Scalar.bIsAvailable = true;
+		Result.Scalar.NsPerSample = MeasureNsPerSample(Options, RandomInputs, Out, Scalar);
+		Scalar(GridInputs.data(), GridOut.data(), GridInputs.size());
+		MeasureError(Reference, GridOut, Result.Scalar);
+
+		const FBatchFunction Batch = BatchFunctions[static_cast<int>(Type)];
+
+		Result.Batched.bIsAvailable = true;
+		Result.Batched.NsPerSample = MeasureNsPerSample(Options, RandomInputs, Out, Batch);
+		Batch(GridInputs.data(), GridOut.data(), GridInputs.size());
+		MeasureError(Reference, GridOut, Result.Batched);
+
+		if (EvaluateSimd(Type, GridInputs.data(), GridOut.data(), GridInputs.size()))
+		{
+			Result.Simd.bIsAvailable = true;
+			MeasureError(Reference, GridOut, Result.Simd);
+			Result.Simd.NsPerSample = MeasureNsPerSample(Options, RandomInputs, Out, [Type](const float* In, float* Output, size_t Num)
+			{
+				EvaluateSimd(Type, In, Output, Num);
+			});
+		}
+
+		const FLookupTable Table(Type, Options.LutSize);
+
+		const auto Lut = [&Table](const float* In, float* Output, size_t Num)
+		{
+			for (size_t Index = 0; Index < Num; ++Index)
+			{
+				Output[Index] = Table.Evaluate(In[Index]);
+			}
+		};
+
+		Result.Lut.bIsAvailable = true;
+		Result.Lut.NsPerSample = MeasureNsPerSample(Options, RandomInputs, Out, Lut);
+		Lut(GridInputs.data(), GridOut.data(), GridInputs.size());
+		MeasureError(Reference, GridOut, Result.Lut);
+
+		return Result;
+	}
+
+	void PrintVariant(const FVariantResult& Variant)
+	{
+		if (Variant.bIsAvailable)
+		{
+			std::printf(" %7.2f %9.2e %9.2e |", Variant.NsPerSample, Variant.MaxError, Variant.MeanError);
+		}
+		else
+		{
+			std::printf(" %7s %9s %9s |", "-", "-", "-");
+		}
+	}
+
+	void WriteVariant(FILE* File, const char* Name, const FVariantResult& Variant, bool bIsLast)
+	{
+		if (Variant.bIsAvailable)
+		{
+			std::fprintf(File, "\"%s\": {\"NsPerSample\": %.4f, \"MaxError\": %.9g, \"MeanError\": %.9g}%s", Name, Variant.NsPerSample,
+				Variant.MaxError, Variant.MeanError, bIsLast ? "" : ", ");
+		}
+		else
+		{
+			std::fprintf(File, "\"%s\": null%s", Name, bIsLast ? "" : ", ");
+		}
+	}
+
+	bool WriteJson(const FOptions& Options, const std::vector<FEaseResult>& Results)
+	{
+		FILE* File = std::fopen(Options.JsonPath.c_str(), "w");
+
+		if (!File)
+		{
+			return false;
+		}
+
+		std::fprintf(File, "{\n\t\"Samples\": %zu,\n\t\"Repeats\": %d,\n\t\"LutSize\": %d,\n\t\"Simd\": \"%s\",\n\t\"Eases\": [\n",
+			Options.NumSamples, Options.NumRepeats, Options.LutSize, EASE_BENCHMARK_SSE ? "SSE2" : "none");
+
+		for (size_t Index = 0; Index < Results.size(); ++Index)
+		{
+			const FEaseResult& Result = Results[Index];
+
+			std::fprintf(File, "\t\t{\"EaseType\": \"%s\", ", EaseNames[static_cast<int>(Result.Type)]);
+			WriteVariant(File, "Scalar", Result.Scalar, false);
+			WriteVariant(File, "Batched", Result.Batched, false);
+			WriteVariant(File, "Simd", Result.Simd, false);
+			WriteVariant(File, "Lut", Result.Lut, true);
+			std::fprintf(File, "}%s\n", Index + 1 < Results.size() ? "," : "");
+		}
+
+		std::fprintf(File, "\t]\n}\n");
+		std::fclose(File);
+
+		return true;
+	}
+
+	bool ParseOptions(int Argc, char** Argv, FOptions& Options)
+	{
+		for (int Index = 1; Index < Argc; ++Index)
+		{
+			const bool bHasValue = Index + 1 < Argc;
+
+			if (std::strcmp(Argv[Index], "--samples") == 0 && bHasValue)
+			{
+				Options.NumSamples = std::max<long long>(std::atoll(Argv[++Index]), 16);
+			}
+			else if (std::strcmp(Argv[Index], "--repeats") == 0 && bHasValue)
+			{
+				Options.NumRepeats = std::max(std::atoi(Argv[++Index]), 1);
+			}
+			else if (std::strcmp(Argv[Index], "--lut-size") == 0 && bHasValue)
+			{
+				Options.LutSize = std::max(std::atoi(Argv[++Index]), 2);
+			}
+			else if (std::strcmp(Argv[Index], "--json") == 0 && bHasValue)
+			{
+				Options.JsonPath = Argv[++Index];
+			}
+			else
+			{
+				std::fprintf(stderr, "usage: %s [--samples N] [--repeats N] [--lut-size N] [--json path]\n", Argv[0]);
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+int main(int Argc, char** Argv)
+{
+	FOptions Options;
+
+	if (!ParseOptions(Argc, Argv, Options))
+	{
+		return 1;
+	}
+
+	// random order for throughput so piecewise eases can't ride the branch predictor, an even grid for accuracy
+	std::vector<float> RandomInputs(Options.NumSamples);
+	std::vector<float> GridInputs(Options.NumSamples);
+
+	uint32_t Seed = 0x12345678u;
+
+	for (size_t Index = 0; Index < Options.NumSamples; ++Index)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		RandomInputs[Index] = static_cast<float>(Seed >> 8) / static_cast<float>(1u << 24);
+		GridInputs[Index] = static_cast<float>(static_cast<double>(Index) / (Options.NumSamples - 1));
+	}
+
+	std::vector<FEaseResult> Results;
+
+	// comfortably above float rounding for every ease, far below a wrong coefficient
+	constexpr double ShippingTolerance = 1.e-4;
+	bool bHasMismatch = false;
+
+	std::printf("%-22s | %-27s | %-27s | %-27s | %-27s |\n", "", "scalar ns  max err  mean err", "batched", "simd", "lut");
+
+	for (int Type = 0; Type < static_cast<int>(EEase::Count); ++Type)
+	{
+		Results.push_back(MeasureEase(static_cast<EEase>(Type), Options, RandomInputs, GridInputs));
+
+		std::printf("%-22s |", EaseNames[Type]);
+		PrintVariant(Results.back().Scalar);
+		PrintVariant(Results.back().Batched);
+		PrintVariant(Results.back().Simd);
+		PrintVariant(Results.back().Lut);
+		std::printf("\n");
+	}
+
+	for (const FEaseResult& Result : Results)
+	{
+		if (Result.Scalar.MaxError > ShippingTolerance)
+		{
+			std::printf("%s: the shipping ease is %.3g away from its definition\n", EaseNames[static_cast<int>(Result.Type)], Result.Scalar.MaxError);
+			bHasMismatch = true;
+		}
+	}
+
+	if (!Options.JsonPath.empty() && !WriteJson(Options, Results))
+	{
+		std::fprintf(stderr, "couldn't write %s\n", Options.JsonPath.c_str());
+		return 1;
+	}
+
+	return bHasMismatch ? 2 : 0;
+}
@@ -0,0 +1,315 @@
+#include "TweenerBenchmarkCommandlet.h"
+
+#include "Tween.h"
+#include "TweenerSubsystem.h"
+#include "Components/Image.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialInterface.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTweenerBenchmark, Log, All);
+
+namespace TweenerBenchmark
+{
+	/** Tweens share targets, so the setup cost of a million components doesn't swamp the run */
+	constexpr int32 NumTargets = 1024;
+
+	constexpr float FrameDeltaSeconds = 1.f / 60.f;
+
+	/** Objects made once per run that the tweens are spread over */
+	struct FTargets
+	{
+		TArray<USceneComponent*> SceneComponents;
+		UInstancedStaticMeshComponent* InstancedStaticMesh = nullptr;
+		TArray<UMaterialInstanceDynamic*> Materials;
+		FName MaterialParameter;
+		TArray<UWidget*> Widgets;
+		TArray<UTweenerBenchmarkTarget*> Objects;
+	};
+
+	static int32 GetNumLiveObjects()
+	{
+		return GUObjectArray.GetObjectArrayNumMinusAvailable();
+	}
+
+	static FTargets CreateTargets(UWorld& World, UMaterialInterface* Material, FName MaterialParameter)
+	{
+		FTargets Targets;
+
+		AActor* Actor = World.SpawnActor<AActor>();
+
+		USceneComponent* Root = NewObject<USceneComponent>(Actor);
+		Actor->SetRootComponent(Root);
+		Root->RegisterComponent();
+
+		Targets.InstancedStaticMesh = NewObject<UInstancedStaticMeshComponent>(Actor);
+		Targets.InstancedStaticMesh->SetupAttachment(Root);
+		Targets.InstancedStaticMesh->RegisterComponent();
+
+		Targets.MaterialParameter = MaterialParameter;
+
+		for (int32 Index = 0; Index < NumTargets; ++Index)
+		{
+			USceneComponent* SceneComponent = NewObject<USceneComponent>(Actor);
+			SceneComponent->SetupAttachment(Root);
+			SceneComponent->RegisterComponent();
+			Targets.SceneComponents.Add(SceneComponent);
+
+			Targets.InstancedStaticMesh->AddInstance(FTransform(FVector(Index * 100.f, 0.f, 0.f)));
+
+			if (Material)
+			{
+				Targets.Materials.Add(UMaterialInstanceDynamic::Create(Material, Actor));
+			}
+
+			Targets.Widgets.Add(NewObject<UImage>(Actor));
+			Targets.Objects.Add(NewObject<UTweenerBenchmarkTarget>(Actor));
+		}
+
+		return Targets;
+	}
+
+	static UTween* CreateTween(const FTargets& Targets, ETweenTargetObjectType TargetType, int32 Index, EEaseType EaseType, UWorld& World)
+	{
+		const int32 Target = Index % NumTargets;
+
+		// ping-pong forever with a duration longer than the run, so every tween is active on every frame
+		const float Duration = 10.f;
+		const ELoopType LoopType = ELoopType::PingPong;
+
+		switch (TargetType)
+		{
+			case ETweenTargetObjectType::SceneComponent:
+				return UTween::ComponentRelativeLocationTo(Targets.SceneComponents[Target], FVector(100.f, 0.f, 0.f), true, Duration, EaseType, LoopType, 0, 0.f, &World);
+
+			case ETweenTargetObjectType::InstancedStaticMesh:
+				return UTween::InstanceRelativeLocationTo(Targets.InstancedStaticMesh, Target, FVector(0.f, 0.f, 100.f), true, Duration, EaseType, LoopType, 0, 0.f, &World);
+
+			case ETweenTargetObjectType::Material:
+				return Targets.Materials.Num() > 0
+					? UTween::MaterialScalarTo(Targets.Materials[Target], Targets.MaterialParameter, 1.f, false, Duration, EaseType, LoopType, 0, 0.f, &World)
+					: nullptr;
+
+			case ETweenTargetObjectType::Widget:
+				return UTween::WidgetRenderOpacityTo(Targets.Widgets[Target], 0.f, false, Duration, EaseType, LoopType, 0, 0.f, &World);
+
+			case ETweenTargetObjectType::Property:
+				return UTween::FloatTo(Targets.Objects[Target], GET_MEMBER_NAME_CHECKED(UTweenerBenchmarkTarget, Value), 1.f, false, Duration, EaseType, LoopType, 0, 0.f, &World);
+
+			case ETweenTargetObjectType::CustomAction:
+				return UTween::CustomAction(Targets.Objects[Target], 0.f, 1.f, Duration, EaseType, LoopType, 0, 0.f, &World);
+
+			default:
+				return nullptr;
+		}
+	}
+
+	static TSharedRef<FJsonObject> Run(UWorld& World, UTweenerSubsystem& Subsystem, const FTargets& Targets, ETweenTargetObjectType TargetType, int32 Count, int32 Frames)
+	{
+		const UEnum* TargetTypeEnum = StaticEnum<ETweenTargetObjectType>();
+		const UEnum* EaseTypeEnum = StaticEnum<EEaseType>();
+		const int32 NumEaseTypes = EaseTypeEnum->NumEnums() - 1;
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("TargetType"), TargetTypeEnum->GetNameStringByValue(static_cast<int64>(TargetType)));
+		Result->SetNumberField(TEXT("Count"), Count);
+
+		const int32 ObjectsBeforeStart = GetNumLiveObjects();
+		const uint64 MemoryBeforeStart = FPlatformMemory::GetStats().UsedPhysical;
+		const double StartTime = FPlatformTime::Seconds();
+
+		int32 NumStarted = 0;
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const EEaseType EaseType = static_cast<EEaseType>(EaseTypeEnum->GetValueByIndex(Index % NumEaseTypes));
+
+			UTween* Tween = CreateTween(Targets, TargetType, Index, EaseType, World);
+
+			if (Tween && EaseType == EEaseType::CubicBezier)
+			{
+				Tween->SetCubicBezier(0.25f, 0.1f, 0.25f, 1.f);
+			}
+
+			NumStarted += Subsystem.StartTween(Tween) ? 1 : 0;
+		}
+
+		const double StartSeconds = FPlatformTime::Seconds() - StartTime;
+
+		if (NumStarted == 0)
+		{
+			Result->SetStringField(TEXT("Skipped"), TEXT("No tweens could be started for this target type"));
+			return Result;
+		}
+
+		Result->SetNumberField(TEXT("StartedTweens"), NumStarted);
+		Result->SetNumberField(TEXT("StartNsPerTween"), StartSeconds * 1e9 / NumStarted);
+		Result->SetNumberField(TEXT("StartObjectsAllocated"), GetNumLiveObjects() - ObjectsBeforeStart);
+		Result->SetNumberField(TEXT("StartMemoryBytes"), static_cast<double>(FPlatformMemory::GetStats().UsedPhysical) - MemoryBeforeStart);
+
+		const int32 ObjectsBeforeTicking = GetNumLiveObjects();
+		const uint64 MemoryBeforeTicking = FPlatformMemory::GetStats().UsedPhysical;
+
+		TArray<double> FrameSeconds;
+		FrameSeconds.Reserve(Frames);
+
+		for (int32 Frame = 0; Frame < Frames; ++Frame)
+		{
+			++GFrameCounter;
+
+			const double FrameStartTime = FPlatformTime::Seconds();
+			World.Tick(LEVELTICK_All, FrameDeltaSeconds);
+			FrameSeconds.Add(FPlatformTime::Seconds() - FrameStartTime);
+		}
+
+		FrameSeconds.Sort();
+
+		double TotalSeconds = 0.0;
+
+		for (const double Seconds : FrameSeconds)
+		{
+			TotalSeconds += Seconds;
+		}
+
+		const auto NsPerTween = [NumStarted](double Seconds) { return Seconds * 1e9 / NumStarted; };
+
+		Result->SetNumberField(TEXT("Frames"), Frames);
+		Result->SetNumberField(TEXT("NsPerTweenPerFrame"), NsPerTween(TotalSeconds / Frames));
+		Result->SetNumberField(TEXT("NsPerTweenPerFrameMin"), NsPerTween(FrameSeconds[0]));
+		Result->SetNumberField(TEXT("NsPerTweenPerFrameMedian"), NsPerTween(FrameSeconds[Frames / 2]));
+		Result->SetNumberField(TEXT("NsPerTweenPerFrameMax"), NsPerTween(FrameSeconds.Last()));
+		Result->SetNumberField(TEXT("TickObjectsAllocated"), GetNumLiveObjects() - ObjectsBeforeTicking);
+		Result->SetNumberField(TEXT("TickMemoryBytes"), static_cast<double>(FPlatformMemory::GetStats().UsedPhysical) - MemoryBeforeTicking);
+
+		Subsystem.StopAllTweens();
+
+		const double GCStartTime = FPlatformTime::Seconds();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		Result->SetNumberField(TEXT("GCMilliseconds"), (FPlatformTime::Seconds() - GCStartTime) * 1000.0);
+
+		return Result;
+	}
+}
+
+UTweenerBenchmarkCommandlet::UTweenerBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UTweenerBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace TweenerBenchmark;
+
+	FString CountsParam = TEXT("1000,10000,100000,1000000");
+	FParse::Value(*Params, TEXT("Counts="), CountsParam);
+
+	TArray<FString> CountStrings;
+	CountsParam.ParseIntoArray(CountStrings, TEXT(","));
+
+	int32 Frames = 60;
+	FParse::Value(*Params, TEXT("Frames="), Frames);
+	Frames = FMath::Max(Frames, 1);
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / TEXT("TweenerBenchmark.json");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	FString MaterialPath;
+	FString MaterialParameter;
+	FParse::Value(*Params, TEXT("Material="), MaterialPath);
+	FParse::Value(*Params, TEXT("MaterialParameter="), MaterialParameter);
+
+	UMaterialInterface* Material = MaterialPath.IsEmpty() ? nullptr : LoadObject<UMaterialInterface>(nullptr, *MaterialPath);
+
+	// widget and material tweens would otherwise complete on start under -nullrhi and measure nothing
+	if (IConsoleVariable* StripCosmeticTweens = IConsoleManager::Get().FindConsoleVariable(TEXT("tweener.StripCosmeticTweens")))
+	{
+		StripCosmeticTweens->Set(0);
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("TweenerBenchmark"));
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	UTweenerSubsystem* Subsystem = World->GetSubsystem<UTweenerSubsystem>();
+
+	if (!Subsystem)
+	{
+		UE_LOG(LogTweenerBenchmark, Error, TEXT("The benchmark world has no tweener subsystem"));
+		return 1;
+	}
+
+	const FTargets Targets = CreateTargets(*World, Material, FName(*MaterialParameter));
+
+	TArray<TSharedPtr<FJsonValue>> Results;
+
+	const UEnum* TargetTypeEnum = StaticEnum<ETweenTargetObjectType>();
+
+	for (const FString& CountString : CountStrings)
+	{
+		const int32 Count = FCString::Atoi(*CountString);
+
+		if (Count <= 0)
+		{
+			continue;
+		}
+
+		for (int32 TargetTypeIndex = 0; TargetTypeIndex < TargetTypeEnum->NumEnums() - 1; ++TargetTypeIndex)
+		{
+			const ETweenTargetObjectType TargetType = static_cast<ETweenTargetObjectType>(TargetTypeEnum->GetValueByIndex(TargetTypeIndex));
+
+			const TSharedRef<FJsonObject> Result = Run(*World, *Subsystem, Targets, TargetType, Count, Frames);
+
+			UE_LOG(LogTweenerBenchmark, Display, TEXT("%s x %d: %.1f ns/tween/frame"), *TargetTypeEnum->GetNameStringByIndex(TargetTypeIndex), Count,
+				Result->HasField(TEXT("NsPerTweenPerFrame")) ? Result->GetNumberField(TEXT("NsPerTweenPerFrame")) : 0.0);
+
+			Results.Add(MakeShared<FJsonValueObject>(Result));
+		}
+	}
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+	Report->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+	Report->SetStringField(TEXT("Configuration"), LexToString(FApp::GetBuildConfiguration()));
+	Report->SetBoolField(TEXT("CanEverRender"), FApp::CanEverRender());
+	Report->SetNumberField(TEXT("FrameDeltaSeconds"), FrameDeltaSeconds);
+	Report->SetNumberField(TEXT("NumTargets"), NumTargets);
+	Report->SetArrayField(TEXT("Results"), Results);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Report, Writer);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+	{
+		UE_LOG(LogTweenerBenchmark, Error, TEXT("Couldn't write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogTweenerBenchmark, Display, TEXT("Wrote %s"), *OutputPath);
+
+	return 0;
+}
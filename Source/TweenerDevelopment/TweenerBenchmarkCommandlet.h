@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TweenerBenchmarkCommandlet.generated.h"
+
+class UTweenerSubsystem;
+class UWorld;
+
+/** Property and custom action target for the benchmark */
+UCLASS()
+class UTweenerBenchmarkTarget : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY()
+	float Value = 0.f;
+};
+
+/**
+ * Starts 1k to 1M tweens on each target type, cycling through every ease, ticks them for a fixed number of frames in
+ * a headless game world and writes the cost as JSON.
+ *
+ * UnrealEditor-Cmd TweenerDevelopment.uproject -run=TweenerBenchmark -nullrhi -unattended
+ *     [-Counts=1000,10000,100000,1000000] [-Frames=60] [-Output=<path>]
+ *     [-Material=<material path> -MaterialParameter=<scalar parameter name>]
+ *
+ * Material tweens need a material with a scalar parameter, without one they are reported as skipped.
+ */
+UCLASS()
+class UTweenerBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UTweenerBenchmarkCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	//~UCommandlet interface
+};
@@ -0,0 +1,857 @@
+#include "TweenerDifferentialCommandlet.h"
+
+#include "Tween.h"
+#include "TweenerBenchmarkCommandlet.h"
+#include "TweenerSubsystem.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Math/RandomStream.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTweenerDifferential, Log, All);
+
+namespace TweenerDifferential
+{
+	/** Mismatches logged in full, the report has all of them */
+	constexpr int32 MaxLoggedMismatches = 20;
+
+	enum class EEventType : uint8
+	{
+		Complete,
+		LoopComplete
+	};
+
+	struct FEvent
+	{
+		int32 Frame = 0;
+		int32 Script = 0;
+		int32 ChainIndex = 0;
+		EEventType Type = EEventType::Complete;
+
+		bool operator==(const FEvent& Other) const
+		{
+			return Frame == Other.Frame && Script == Other.Script && ChainIndex == Other.ChainIndex && Type == Other.Type;
+		}
+
+		FString ToString() const
+		{
+			return FString::Printf(TEXT("frame %d script %d tween %d %s"), Frame, Script, ChainIndex,
+				Type == EEventType::Complete ? TEXT("Complete") : TEXT("LoopComplete"));
+		}
+	};
+
+	/** One tween in a script's chain */
+	struct FScriptTween
+	{
+		EEaseType EaseType = EEaseType::Linear;
+		float To = 0.f;
+		float Duration = 0.f;
+		float Delay = 0.f;
+		ELoopType LoopType = ELoopType::None;
+		int32 Loops = 0;
+		float DelayBetweenLoops = 0.f;
+		bool bIsTimeScaleIndependent = false;
+	};
+
+	/** A chain of tweens on one float property, plus what is done to whichever of them is running on given frames */
+	struct FScript
+	{
+		int32 Index = 0;
+		TArray<FScriptTween> Chain;
+		float TimeScale = 1.f;
+		int32 ReverseFrame = INDEX_NONE;
+		int32 PauseFrame = INDEX_NONE;
+		int32 ResumeFrame = INDEX_NONE;
+		int32 StopFrame = INDEX_NONE;
+		bool bStopBringsToCompletion = false;
+
+		FString ToString() const
+		{
+			const UEnum* EaseTypeEnum = StaticEnum<EEaseType>();
+			const UEnum* LoopTypeEnum = StaticEnum<ELoopType>();
+
+			TArray<FString> Parts;
+
+			for (const FScriptTween& Tween : Chain)
+			{
+				FString Part = FString::Printf(TEXT("%s to %g over %g"), *EaseTypeEnum->GetNameStringByValue(static_cast<int64>(Tween.EaseType)), Tween.To, Tween.Duration);
+
+				if (Tween.Delay > 0.f)
+				{
+					Part += FString::Printf(TEXT(" after %g"), Tween.Delay);
+				}
+
+				if (Tween.LoopType != ELoopType::None)
+				{
+					Part += FString::Printf(TEXT(" %s x%d (%g between)"), *LoopTypeEnum->GetNameStringByValue(static_cast<int64>(Tween.LoopType)), Tween.Loops, Tween.DelayBetweenLoops);
+				}
+
+				if (Tween.bIsTimeScaleIndependent)
+				{
+					Part += TEXT(" unscaled");
+				}
+
+				Parts.Add(MoveTemp(Part));
+			}
+
+			FString Result = FString::Join(Parts, TEXT(" -> "));
+
+			if (TimeScale != 1.f)
+			{
+				Result += FString::Printf(TEXT(", time scale %g"), TimeScale);
+			}
+
+			if (ReverseFrame != INDEX_NONE)
+			{
+				Result += FString::Printf(TEXT(", reverse at %d"), ReverseFrame);
+			}
+
+			if (PauseFrame != INDEX_NONE)
+			{
+				Result += FString::Printf(TEXT(", paused %d-%d"), PauseFrame, ResumeFrame);
+			}
+
+			if (StopFrame != INDEX_NONE)
+			{
+				Result += FString::Printf(TEXT(", stopped at %d%s"), StopFrame, bStopBringsToCompletion ? TEXT(" to completion") : TEXT(""));
+			}
+
+			return Result;
+		}
+	};
+
+	/** Every script's value after every frame and the events in the order they fired */
+	struct FTrace
+	{
+		int32 NumScripts = 0;
+		int32 NumFrames = 0;
+		TArray<float> Values;
+		TArray<FEvent> Events;
+
+		void Initialize(int32 InNumScripts, int32 InNumFrames)
+		{
+			NumScripts = InNumScripts;
+			NumFrames = InNumFrames;
+			Values.SetNumZeroed(NumScripts * NumFrames);
+			Events.Reset();
+		}
+
+		float& GetValue(int32 Frame, int32 RunIndex)
+		{
+			return Values[Frame * NumScripts + RunIndex];
+		}
+
+		float GetValue(int32 Frame, int32 RunIndex) const
+		{
+			return Values[Frame * NumScripts + RunIndex];
+		}
+	};
+
+	/** Something that can run tweens. Add a new tick path here to check it against the others. */
+	class FEngine
+	{
+	public:
+
+		virtual ~FEngine() = default;
+
+		virtual const TCHAR* GetName() const = 0;
+
+		virtual void Start(UTween& Tween) = 0;
+
+		/** Stops the tween without starting the rest of its chain, like UTweenerSubsystem::StopTween */
+		virtual void Stop(UTween& Tween, bool bBringToCompletion) = 0;
+
+		virtual void Tick(float DeltaTime) = 0;
+	};
+
+	/**
+	 * Calls UTween::Tick directly with the least machinery that gives the documented behaviour: no tick groups, time
+	 * domains, budget or significance. Tweens are walked backwards and started tweens wait for the next frame, as in
+	 * the subsystem, so events from different tweens fire in the same order.
+	 */
+	class FReferenceEngine : public FEngine
+	{
+	public:
+
+		virtual const TCHAR* GetName() const override
+		{
+			return TEXT("Reference");
+		}
+
+		virtual void Start(UTween& Tween) override
+		{
+			if (Tween.PrepareForUse())
+			{
+				ActiveTweens.Add(&Tween);
+			}
+		}
+
+		virtual void Stop(UTween& Tween, bool bBringToCompletion) override
+		{
+			if (ActiveTweens.Remove(&Tween) > 0 && bBringToCompletion)
+			{
+				if (Tween.ObjectPtr.IsValid())
+				{
+					Tween.Tick(0.f, 0.f, true);
+				}
+
+				Tween.BroadcastComplete();
+			}
+		}
+
+		virtual void Tick(float DeltaTime) override
+		{
+			const int32 NumTweens = ActiveTweens.Num();
+
+			for (int32 Index = NumTweens - 1; Index >= 0; --Index)
+			{
+				UTween* Tween = ActiveTweens[Index];
+
+				if (Tween == nullptr || Tween->bIsPaused)
+				{
+					continue;
+				}
+
+				const float TweenDeltaTime = DeltaTime * Tween->TimeScale;
+
+				if (Tween->ObjectPtr.IsValid() && !Tween->Tick(TweenDeltaTime, TweenDeltaTime))
+				{
+					continue;
+				}
+
+				ActiveTweens[Index] = nullptr;
+
+				Tween->BroadcastComplete();
+
+				if (Tween->NextTween != nullptr)
+				{
+					Start(*Tween->NextTween);
+				}
+			}
+
+			ActiveTweens.RemoveAll([](const UTween* Tween) { return Tween == nullptr; });
+		}
+
+	private:
+
+		/** Kept alive by the script runner */
+		TArray<UTween*> ActiveTweens;
+	};
+
+	/** The shipping path, the world ticks the subsystem */
+	class FSubsystemEngine : public FEngine
+	{
+	public:
+
+		FSubsystemEngine(UWorld& InWorld, UTweenerSubsystem& InSubsystem)
+			: World(InWorld)
+			, Subsystem(InSubsystem)
+		{
+		}
+
+		virtual const TCHAR* GetName() const override
+		{
+			return TEXT("Subsystem");
+		}
+
+		virtual void Start(UTween& Tween) override
+		{
+			Subsystem.StartTween(&Tween);
+		}
+
+		virtual void Stop(UTween& Tween, bool bBringToCompletion) override
+		{
+			Subsystem.StopTween(&Tween, bBringToCompletion, false);
+		}
+
+		virtual void Tick(float DeltaTime) override
+		{
+			World.Tick(LEVELTICK_All, DeltaTime);
+		}
+
+	private:
+
+		UWorld& World;
+		UTweenerSubsystem& Subsystem;
+	};
+
+	/** Mostly steady frame rates with the occasional hitch, which lands mid delay and mid loop */
+	static TArray<float> GenerateFrameDeltas(int32 Seed, int32 NumFrames)
+	{
+		static const float FrameRates[] = { 30.f, 60.f, 90.f, 144.f };
+
+		FRandomStream Stream(Seed);
+
+		TArray<float> FrameDeltas;
+		FrameDeltas.Reserve(NumFrames);
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			FrameDeltas.Add(Stream.FRand() < 0.02f ? 0.25f : 1.f / FrameRates[Stream.RandHelper(UE_ARRAY_COUNT(FrameRates))]);
+		}
+
+		return FrameDeltas;
+	}
+
+	static FScript GenerateScript(int32 Seed, int32 ScriptIndex, int32 NumFrames)
+	{
+		const UEnum* EaseTypeEnum = StaticEnum<EEaseType>();
+		const int32 NumEaseTypes = EaseTypeEnum->NumEnums() - 1;
+
+		static const ELoopType LoopTypes[] = { ELoopType::None, ELoopType::RestartFromBeginning, ELoopType::PingPong };
+
+		FRandomStream Stream(HashCombine(GetTypeHash(Seed), GetTypeHash(ScriptIndex)));
+
+		FScript Script;
+		Script.Index = ScriptIndex;
+
+		const int32 ChainLength = 1 + (Stream.FRand() < 0.3f ? 1 : 0) + (Stream.FRand() < 0.15f ? 1 : 0);
+
+		for (int32 ChainIndex = 0; ChainIndex < ChainLength; ++ChainIndex)
+		{
+			FScriptTween& Tween = Script.Chain.AddDefaulted_GetRef();
+			Tween.EaseType = static_cast<EEaseType>(EaseTypeEnum->GetValueByIndex(Stream.RandHelper(NumEaseTypes)));
+			Tween.To = Stream.FRandRange(-10.f, 10.f);
+			Tween.Duration = Stream.FRandRange(0.05f, 2.f);
+			Tween.Delay = Stream.FRand() < 0.4f ? Stream.FRandRange(0.f, 0.5f) : 0.f;
+			Tween.LoopType = LoopTypes[Stream.RandHelper(UE_ARRAY_COUNT(LoopTypes))];
+			Tween.Loops = Tween.LoopType != ELoopType::None ? Stream.RandRange(1, 4) : 0;
+			Tween.DelayBetweenLoops = Tween.LoopType != ELoopType::None && Stream.FRand() < 0.5f ? Stream.FRandRange(0.f, 0.3f) : 0.f;
+			Tween.bIsTimeScaleIndependent = Stream.FRand() < 0.2f;
+		}
+
+		Script.TimeScale = Stream.FRand() < 0.25f ? Stream.FRandRange(0.25f, 3.f) : 1.f;
+
+		if (Stream.FRand() < 0.25f)
+		{
+			Script.ReverseFrame = Stream.RandRange(1, NumFrames - 1);
+		}
+
+		if (Stream.FRand() < 0.2f)
+		{
+			Script.PauseFrame = Stream.RandRange(1, NumFrames - 1);
+			Script.ResumeFrame = Script.PauseFrame + Stream.RandRange(1, 60);
+		}
+
+		if (Stream.FRand() < 0.15f)
+		{
+			Script.StopFrame = Stream.RandRange(1, NumFrames - 1);
+			Script.bStopBringsToCompletion = Stream.FRand() < 0.5f;
+		}
+
+		return Script;
+	}
+
+	/** Runs every script through one engine, recording values after each frame and events as they fire */
+	class FScriptRunner
+	{
+	public:
+
+		FScriptRunner(UWorld& InWorld, const TArray<FScript>& InScripts, const TArray<float>& InFrameDeltas)
+			: World(InWorld)
+			, Scripts(InScripts)
+			, FrameDeltas(InFrameDeltas)
+		{
+		}
+
+		FTrace Run(FEngine& Engine)
+		{
+			Trace.Initialize(Scripts.Num(), FrameDeltas.Num());
+			CurrentFrame = 0;
+			Targets.Reset();
+			Tweens.Reset();
+			ActiveChainIndices.Init(0, Scripts.Num());
+
+			for (int32 RunIndex = 0; RunIndex < Scripts.Num(); ++RunIndex)
+			{
+				CreateTweens(RunIndex);
+				Engine.Start(*Tweens[RunIndex][0]);
+			}
+
+			for (int32 Frame = 0; Frame < FrameDeltas.Num(); ++Frame)
+			{
+				CurrentFrame = Frame;
+
+				for (int32 RunIndex = 0; RunIndex < Scripts.Num(); ++RunIndex)
+				{
+					ApplyActions(Engine, RunIndex, Frame);
+				}
+
+				++GFrameCounter;
+				FApp::SetDeltaTime(FrameDeltas[Frame]);
+
+				Engine.Tick(FrameDeltas[Frame]);
+
+				for (int32 RunIndex = 0; RunIndex < Scripts.Num(); ++RunIndex)
+				{
+					Trace.GetValue(Frame, RunIndex) = Targets[RunIndex]->Value;
+				}
+			}
+
+			// whatever is still running goes with the engine's world, the runner stops keeping it alive
+			Tweens.Reset();
+			Targets.Reset();
+
+			return MoveTemp(Trace);
+		}
+
+	private:
+
+		void CreateTweens(int32 RunIndex)
+		{
+			const FScript& Script = Scripts[RunIndex];
+
+			UTweenerBenchmarkTarget* Target = NewObject<UTweenerBenchmarkTarget>(GetTransientPackage());
+			Targets.Emplace(Target);
+
+			TArray<TStrongObjectPtr<UTween>>& Chain = Tweens.AddDefaulted_GetRef();
+
+			UTween* Previous = nullptr;
+
+			for (int32 ChainIndex = 0; ChainIndex < Script.Chain.Num(); ++ChainIndex)
+			{
+				const FScriptTween& ScriptTween = Script.Chain[ChainIndex];
+
+				UTween* Tween = Previous
+					? Previous->NextScalarTo(ScriptTween.To, ScriptTween.Duration, ScriptTween.Delay)
+					: UTween::FloatTo(Target, GET_MEMBER_NAME_CHECKED(UTweenerBenchmarkTarget, Value), ScriptTween.To, false, ScriptTween.Duration,
+						ScriptTween.EaseType, ELoopType::None, 0, 0.f, &World);
+
+				if (ScriptTween.EaseType == EEaseType::CubicBezier)
+				{
+					Tween->SetCubicBezier(0.42f, 0.f, 0.58f, 1.f);
+				}
+				else
+				{
+					Tween->SetEaseType(ScriptTween.EaseType);
+				}
+
+				// chained tweens inherit the loops of the tween before them, already doubled for ping-pong
+				Tween->SetLoopType(ScriptTween.LoopType, ScriptTween.Loops, ScriptTween.DelayBetweenLoops);
+				Tween->SetDelay(ScriptTween.Delay);
+
+				if (ScriptTween.bIsTimeScaleIndependent)
+				{
+					Tween->SetTimeScaleIndependent();
+				}
+
+				// copied along the chain when the next tween is made
+				if (!Previous)
+				{
+					Tween->SetTimeScale(Script.TimeScale);
+					Tween->SetSignificanceThrottled(false);
+				}
+
+				Tween->OnComplete().AddRaw(this, &FScriptRunner::OnEvent, RunIndex, ChainIndex, EEventType::Complete);
+				Tween->OnLoopComplete().AddRaw(this, &FScriptRunner::OnEvent, RunIndex, ChainIndex, EEventType::LoopComplete);
+
+				Chain.Emplace(Tween);
+				Previous = Tween;
+			}
+		}
+
+		void ApplyActions(FEngine& Engine, int32 RunIndex, int32 Frame)
+		{
+			const FScript& Script = Scripts[RunIndex];
+			const int32 ChainIndex = ActiveChainIndices[RunIndex];
+
+			if (!Tweens[RunIndex].IsValidIndex(ChainIndex))
+			{
+				return;
+			}
+
+			UTween& Tween = *Tweens[RunIndex][ChainIndex];
+
+			if (Frame == Script.ReverseFrame)
+			{
+				Tween.ReverseTween();
+			}
+
+			if (Frame == Script.PauseFrame)
+			{
+				Tween.bIsPaused = true;
+			}
+
+			if (Frame == Script.ResumeFrame)
+			{
+				Tween.bIsPaused = false;
+			}
+
+			if (Frame == Script.StopFrame)
+			{
+				Engine.Stop(Tween, Script.bStopBringsToCompletion);
+				ActiveChainIndices[RunIndex] = INDEX_NONE;
+			}
+		}
+
+		void OnEvent(int32 RunIndex, int32 ChainIndex, EEventType Type)
+		{
+			FEvent& Event = Trace.Events.AddDefaulted_GetRef();
+			Event.Frame = CurrentFrame;
+			Event.Script = Scripts[RunIndex].Index;
+			Event.ChainIndex = ChainIndex;
+			Event.Type = Type;
+
+			// script actions follow the chain, a pause set on one tween stays with it
+			if (Type == EEventType::Complete && ActiveChainIndices[RunIndex] == ChainIndex)
+			{
+				ActiveChainIndices[RunIndex] = ChainIndex + 1;
+			}
+		}
+
+		UWorld& World;
+		const TArray<FScript>& Scripts;
+		const TArray<float>& FrameDeltas;
+
+		FTrace Trace;
+		int32 CurrentFrame = 0;
+
+		TArray<TStrongObjectPtr<UTweenerBenchmarkTarget>> Targets;
+		TArray<TArray<TStrongObjectPtr<UTween>>> Tweens;
+
+		/** Tween in each chain the script's actions apply to */
+		TArray<int32> ActiveChainIndices;
+	};
+
+	static TSharedRef<FJsonObject> MakeMismatch(const FScript* Script, const TCHAR* Kind, int32 Frame, const FString& Expected, const FString& Actual)
+	{
+		TSharedRef<FJsonObject> Mismatch = MakeShared<FJsonObject>();
+		Mismatch->SetStringField(TEXT("Kind"), Kind);
+		Mismatch->SetNumberField(TEXT("Frame"), Frame);
+		Mismatch->SetStringField(TEXT("Expected"), Expected);
+		Mismatch->SetStringField(TEXT("Actual"), Actual);
+
+		if (Script)
+		{
+			Mismatch->SetNumberField(TEXT("Script"), Script->Index);
+			Mismatch->SetStringField(TEXT("Description"), Script->ToString());
+		}
+
+		return Mismatch;
+	}
+
+	/**
+	 * First differing value and first differing event of each script, then, if every script's own events agree, the
+	 * first place the interleaving of events across scripts differs.
+	 */
+	static TArray<TSharedPtr<FJsonValue>> Compare(const FTrace& Expected, const FTrace& Actual, const TArray<FScript>& Scripts, float Tolerance)
+	{
+		TArray<TSharedPtr<FJsonValue>> Mismatches;
+
+		bool bHaveEventMismatch = false;
+
+		for (int32 RunIndex = 0; RunIndex < Scripts.Num(); ++RunIndex)
+		{
+			const FScript& Script = Scripts[RunIndex];
+
+			for (int32 Frame = 0; Frame < Expected.NumFrames; ++Frame)
+			{
+				const float ExpectedValue = Expected.GetValue(Frame, RunIndex);
+				const float ActualValue = Actual.GetValue(Frame, RunIndex);
+
+				if (!(FMath::Abs(ExpectedValue - ActualValue) <= Tolerance))
+				{
+					Mismatches.Add(MakeShared<FJsonValueObject>(MakeMismatch(&Script, TEXT("Value"), Frame,
+						FString::SanitizeFloat(ExpectedValue), FString::SanitizeFloat(ActualValue))));
+					break;
+				}
+			}
+
+			const auto IsScriptEvent = [&Script](const FEvent& Event) { return Event.Script == Script.Index; };
+
+			const TArray<FEvent> ExpectedEvents = Expected.Events.FilterByPredicate(IsScriptEvent);
+			const TArray<FEvent> ActualEvents = Actual.Events.FilterByPredicate(IsScriptEvent);
+
+			for (int32 Index = 0; Index < FMath::Max(ExpectedEvents.Num(), ActualEvents.Num()); ++Index)
+			{
+				const FEvent* ExpectedEvent = ExpectedEvents.IsValidIndex(Index) ? &ExpectedEvents[Index] : nullptr;
+				const FEvent* ActualEvent = ActualEvents.IsValidIndex(Index) ? &ActualEvents[Index] : nullptr;
+
+				if (!ExpectedEvent || !ActualEvent || !(*ExpectedEvent == *ActualEvent))
+				{
+					Mismatches.Add(MakeShared<FJsonValueObject>(MakeMismatch(&Script, TEXT("Event"), (ExpectedEvent ? ExpectedEvent : ActualEvent)->Frame,
+						ExpectedEvent ? ExpectedEvent->ToString() : TEXT("none"), ActualEvent ? ActualEvent->ToString() : TEXT("none"))));
+					bHaveEventMismatch = true;
+					break;
+				}
+			}
+		}
+
+		if (!bHaveEventMismatch)
+		{
+			for (int32 Index = 0; Index < Expected.Events.Num(); ++Index)
+			{
+				if (!(Expected.Events[Index] == Actual.Events[Index]))
+				{
+					Mismatches.Add(MakeShared<FJsonValueObject>(MakeMismatch(nullptr, TEXT("EventOrder"), Expected.Events[Index].Frame,
+						Expected.Events[Index].ToString(), Actual.Events[Index].ToString())));
+					break;
+				}
+			}
+		}
+
+		return Mismatches;
+	}
+
+	static TSharedRef<FJsonObject> TraceToJson(const FTrace& Trace, int32 Seed, int32 NumScripts, int32 OnlyScript)
+	{
+		TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetNumberField(TEXT("Seed"), Seed);
+		Json->SetNumberField(TEXT("Scripts"), NumScripts);
+		Json->SetNumberField(TEXT("Script"), OnlyScript);
+		Json->SetNumberField(TEXT("Frames"), Trace.NumFrames);
+
+		TArray<TSharedPtr<FJsonValue>> Values;
+		Values.Reserve(Trace.Values.Num());
+
+		for (const float Value : Trace.Values)
+		{
+			Values.Add(MakeShared<FJsonValueNumber>(Value));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Events;
+		Events.Reserve(Trace.Events.Num());
+
+		for (const FEvent& Event : Trace.Events)
+		{
+			Events.Add(MakeShared<FJsonValueArray>(TArray<TSharedPtr<FJsonValue>>
+			{
+				MakeShared<FJsonValueNumber>(Event.Frame),
+				MakeShared<FJsonValueNumber>(Event.Script),
+				MakeShared<FJsonValueNumber>(Event.ChainIndex),
+				MakeShared<FJsonValueNumber>(static_cast<int32>(Event.Type))
+			}));
+		}
+
+		Json->SetArrayField(TEXT("Values"), Values);
+		Json->SetArrayField(TEXT("Events"), Events);
+
+		return Json;
+	}
+
+	/** Only loads a trace recorded with the same seed, script count, script filter and frame count */
+	static bool TraceFromJson(const FJsonObject& Json, int32 Seed, int32 NumScripts, int32 OnlyScript, int32 NumRunScripts, int32 NumFrames, FTrace& OutTrace)
+	{
+		if (Json.GetIntegerField(TEXT("Seed")) != Seed || Json.GetIntegerField(TEXT("Scripts")) != NumScripts
+			|| Json.GetIntegerField(TEXT("Script")) != OnlyScript || Json.GetIntegerField(TEXT("Frames")) != NumFrames)
+		{
+			return false;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>& Values = Json.GetArrayField(TEXT("Values"));
+
+		if (Values.Num() != NumRunScripts * NumFrames)
+		{
+			return false;
+		}
+
+		OutTrace.Initialize(NumRunScripts, NumFrames);
+
+		for (int32 Index = 0; Index < Values.Num(); ++Index)
+		{
+			OutTrace.Values[Index] = static_cast<float>(Values[Index]->AsNumber());
+		}
+
+		for (const TSharedPtr<FJsonValue>& EventValue : Json.GetArrayField(TEXT("Events")))
+		{
+			const TArray<TSharedPtr<FJsonValue>>& Fields = EventValue->AsArray();
+
+			if (Fields.Num() != 4)
+			{
+				return false;
+			}
+
+			FEvent& Event = OutTrace.Events.AddDefaulted_GetRef();
+			Event.Frame = static_cast<int32>(Fields[0]->AsNumber());
+			Event.Script = static_cast<int32>(Fields[1]->AsNumber());
+			Event.ChainIndex = static_cast<int32>(Fields[2]->AsNumber());
+			Event.Type = static_cast<EEventType>(static_cast<int32>(Fields[3]->AsNumber()));
+		}
+
+		return true;
+	}
+
+	static FString JsonToString(const TSharedRef<FJsonObject>& Json)
+	{
+		FString String;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&String);
+		FJsonSerializer::Serialize(Json, Writer);
+		return String;
+	}
+}
+
+UTweenerDifferentialCommandlet::UTweenerDifferentialCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UTweenerDifferentialCommandlet::Main(const FString& Params)
+{
+	using namespace TweenerDifferential;
+
+	int32 Seed = 1;
+	int32 NumScripts = 200;
+	int32 NumFrames = 600;
+	float Tolerance = 1.e-4f;
+	int32 OnlyScript = INDEX_NONE;
+	FString RecordPath;
+	FString BaselinePath;
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Differential") / TEXT("TweenerDifferential.json");
+
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("Scripts="), NumScripts);
+	FParse::Value(*Params, TEXT("Frames="), NumFrames);
+	FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+	FParse::Value(*Params, TEXT("Script="), OnlyScript);
+	FParse::Value(*Params, TEXT("Record="), RecordPath);
+	FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	NumScripts = FMath::Max(NumScripts, 1);
+	NumFrames = FMath::Max(NumFrames, 2);
+
+	const TArray<float> FrameDeltas = GenerateFrameDeltas(Seed, NumFrames);
+
+	TArray<FScript> Scripts;
+
+	for (int32 ScriptIndex = 0; ScriptIndex < NumScripts; ++ScriptIndex)
+	{
+		if (OnlyScript == INDEX_NONE || OnlyScript == ScriptIndex)
+		{
+			Scripts.Add(GenerateScript(Seed, ScriptIndex, NumFrames));
+		}
+	}
+
+	if (Scripts.Num() == 0)
+	{
+		UE_LOG(LogTweenerDifferential, Error, TEXT("There is no script %d"), OnlyScript);
+		return 1;
+	}
+
+	FTrace Baseline;
+
+	if (!BaselinePath.IsEmpty())
+	{
+		FString BaselineString;
+		TSharedPtr<FJsonObject> BaselineJson;
+
+		if (!FFileHelper::LoadFileToString(BaselineString, *BaselinePath)
+			|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineString), BaselineJson) || !BaselineJson.IsValid()
+			|| !TraceFromJson(*BaselineJson, Seed, NumScripts, OnlyScript, Scripts.Num(), NumFrames, Baseline))
+		{
+			UE_LOG(LogTweenerDifferential, Error, TEXT("Couldn't load %s, or it was recorded with a different -Seed, -Scripts, -Script or -Frames"), *BaselinePath);
+			return 1;
+		}
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("TweenerDifferential"));
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	UTweenerSubsystem* Subsystem = World->GetSubsystem<UTweenerSubsystem>();
+
+	if (!Subsystem)
+	{
+		UE_LOG(LogTweenerDifferential, Error, TEXT("The differential world has no tweener subsystem"));
+		return 1;
+	}
+
+	FScriptRunner Runner(*World, Scripts, FrameDeltas);
+
+	FReferenceEngine ReferenceEngine;
+	FSubsystemEngine SubsystemEngine(*World, *Subsystem);
+
+	const FTrace ReferenceTrace = Runner.Run(ReferenceEngine);
+	const FTrace SubsystemTrace = Runner.Run(SubsystemEngine);
+
+	Subsystem->StopAllTweens();
+
+	struct FComparison
+	{
+		const TCHAR* ExpectedName;
+		const FTrace* Expected;
+		const TCHAR* ActualName;
+		const FTrace* Actual;
+	};
+
+	TArray<FComparison> Comparisons = { { ReferenceEngine.GetName(), &ReferenceTrace, SubsystemEngine.GetName(), &SubsystemTrace } };
+
+	if (!BaselinePath.IsEmpty())
+	{
+		Comparisons.Add({ TEXT("Baseline"), &Baseline, SubsystemEngine.GetName(), &SubsystemTrace });
+	}
+
+	TArray<TSharedPtr<FJsonValue>> ComparisonResults;
+	int32 NumMismatches = 0;
+
+	for (const FComparison& Comparison : Comparisons)
+	{
+		const TArray<TSharedPtr<FJsonValue>> Mismatches = Compare(*Comparison.Expected, *Comparison.Actual, Scripts, Tolerance);
+
+		UE_LOG(LogTweenerDifferential, Display, TEXT("%s vs %s: %d mismatches over %d scripts and %d frames"), Comparison.ExpectedName, Comparison.ActualName,
+			Mismatches.Num(), Scripts.Num(), NumFrames);
+
+		for (int32 Index = 0; Index < FMath::Min(Mismatches.Num(), MaxLoggedMismatches); ++Index)
+		{
+			const FJsonObject& Mismatch = *Mismatches[Index]->AsObject();
+
+			UE_LOG(LogTweenerDifferential, Warning, TEXT("  %s at frame %d, expected %s, got %s. Script %d: %s"), *Mismatch.GetStringField(TEXT("Kind")),
+				static_cast<int32>(Mismatch.GetNumberField(TEXT("Frame"))), *Mismatch.GetStringField(TEXT("Expected")), *Mismatch.GetStringField(TEXT("Actual")),
+				Mismatch.HasField(TEXT("Script")) ? static_cast<int32>(Mismatch.GetNumberField(TEXT("Script"))) : INDEX_NONE,
+				Mismatch.HasField(TEXT("Description")) ? *Mismatch.GetStringField(TEXT("Description")) : TEXT(""));
+		}
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("Expected"), Comparison.ExpectedName);
+		Result->SetStringField(TEXT("Actual"), Comparison.ActualName);
+		Result->SetArrayField(TEXT("Mismatches"), Mismatches);
+		ComparisonResults.Add(MakeShared<FJsonValueObject>(Result));
+
+		NumMismatches += Mismatches.Num();
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	if (!RecordPath.IsEmpty())
+	{
+		if (!FFileHelper::SaveStringToFile(JsonToString(TraceToJson(SubsystemTrace, Seed, NumScripts, OnlyScript)), *RecordPath))
+		{
+			UE_LOG(LogTweenerDifferential, Error, TEXT("Couldn't write %s"), *RecordPath);
+			return 1;
+		}
+
+		UE_LOG(LogTweenerDifferential, Display, TEXT("Recorded %s"), *RecordPath);
+	}
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetNumberField(TEXT("Seed"), Seed);
+	Report->SetNumberField(TEXT("Scripts"), Scripts.Num());
+	Report->SetNumberField(TEXT("Frames"), NumFrames);
+	Report->SetNumberField(TEXT("Tolerance"), Tolerance);
+	Report->SetArrayField(TEXT("Comparisons"), ComparisonResults);
+
+	if (!FFileHelper::SaveStringToFile(JsonToString(Report), *OutputPath))
+	{
+		UE_LOG(LogTweenerDifferential, Error, TEXT("Couldn't write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogTweenerDifferential, Display, TEXT("Wrote %s"), *OutputPath);
+
+	return NumMismatches > 0 ? 1 : 0;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TweenerDifferentialCommandlet.generated.h"
+
+/**
+ * Runs the same randomized tween scripts through a reference engine, which calls UTween::Tick directly, and through
+ * the subsystem. Compares the value of every tween each frame within a tolerance and the order of complete and loop
+ * complete events. Scripts cover eases, delays, restart and ping-pong loops, delays between loops, time scales,
+ * chains, ReverseTween, pausing and stopping.
+ *
+ * A trace can also be recorded and compared against in a later build, to check changes to UTween itself.
+ *
+ * UnrealEditor-Cmd TweenerDevelopment.uproject -run=TweenerDifferential -nullrhi -unattended
+ *     [-Seed=1] [-Scripts=200] [-Frames=600] [-Tolerance=0.0001] [-Script=<index>]
+ *     [-Record=<path>] [-Baseline=<path>] [-Output=<path>]
+ *
+ * Returns 1 if anything differs.
+ */
+UCLASS()
+class UTweenerDifferentialCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UTweenerDifferentialCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	//~UCommandlet interface
+};
@@ -0,0 +1,157 @@
+#include "Tween.h"
+#include "TweenerBenchmarkCommandlet.h"
+#include "TweenerSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace TweenerFixedStepTest
+{
+	const FName TimeDomain(TEXT("FixedStepTest"));
+
+	constexpr int32 StepsPerSecond = 60;
+
+	constexpr int32 NumSteps = 600;
+
+	struct FTweenSetup
+	{
+		EEaseType EaseType;
+		float Duration;
+		float Delay;
+		ELoopType LoopType;
+		int32 Loops;
+		float DelayBetweenLoops;
+		float TimeScale;
+	};
+
+	/** Durations and delays that aren't whole steps, which is where summed float time used to drift */
+	const FTweenSetup Setups[] =
+	{
+		{ EEaseType::Linear, 0.1f, 0.f, ELoopType::None, 0, 0.f, 1.f },
+		{ EEaseType::QuadraticEaseInOut, 1.f / 3.f, 0.05f, ELoopType::PingPong, 3, 0.1f, 1.f },
+		{ EEaseType::ElasticEaseOut, 0.7f, 0.f, ELoopType::RestartFromBeginning, 4, 0.033f, 1.f },
+		{ EEaseType::BounceEaseOut, 0.35f, 0.2f, ELoopType::PingPong, 5, 0.f, 0.75f },
+	};
+
+	/** ceil(0.1 * 60), the first setup has no delay or loops */
+	constexpr int32 LinearCompleteStep = 6;
+
+	struct FRun
+	{
+		/** Bits of every target's value after each step */
+		TArray<uint32> Values;
+
+		/** Step each tween completed on */
+		TArray<int32> CompleteSteps;
+	};
+
+	/** Plays every setup one step per frame, with FrameDeltas as the world's frame times */
+	FRun Run(UWorld& World, UTweenerSubsystem& Subsystem, const TArray<float>& FrameDeltas)
+	{
+		FRun Result;
+		Result.CompleteSteps.Init(INDEX_NONE, UE_ARRAY_COUNT(Setups));
+
+		TArray<TStrongObjectPtr<UTweenerBenchmarkTarget>> Targets;
+		int32 Step = 0;
+
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(Setups); ++Index)
+		{
+			const FTweenSetup& Setup = Setups[Index];
+
+			UTweenerBenchmarkTarget* Target = NewObject<UTweenerBenchmarkTarget>(GetTransientPackage());
+			Targets.Emplace(Target);
+
+			UTween* Tween = UTween::FloatTo(Target, GET_MEMBER_NAME_CHECKED(UTweenerBenchmarkTarget, Value), 10.f, false, Setup.Duration,
+				Setup.EaseType, Setup.LoopType, Setup.Loops, Setup.DelayBetweenLoops, &World);
+
+			Tween->SetDelay(Setup.Delay)->SetTimeScale(Setup.TimeScale)->SetTimeDomain(TimeDomain);
+
+			Tween->OnComplete().AddLambda([&Result, &Step, Index]()
+			{
+				Result.CompleteSteps[Index] = Step;
+			});
+
+			Subsystem.StartTween(Tween);
+		}
+
+		for (Step = 1; Step <= NumSteps; ++Step)
+		{
+			Subsystem.AdvanceTimeDomain(TimeDomain, 1);
+			World.Tick(LEVELTICK_All, FrameDeltas[Step - 1]);
+
+			for (const TStrongObjectPtr<UTweenerBenchmarkTarget>& Target : Targets)
+			{
+				Result.Values.Add(BitCast<uint32>(Target->Value));
+			}
+		}
+
+		Subsystem.StopAllTweens(false);
+
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenerFixedStepBitIdenticalTest, "Tweener.FixedStep.BitIdentical",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTweenerFixedStepBitIdenticalTest::RunTest(const FString& Parameters)
+{
+	using namespace TweenerFixedStepTest;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("TweenerFixedStepTest"));
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	UTweenerSubsystem* Subsystem = World->GetSubsystem<UTweenerSubsystem>();
+
+	if (TestNotNull(TEXT("Tweener subsystem"), Subsystem))
+	{
+		Subsystem->SetTimeDomainFixedStep(TimeDomain, StepsPerSecond, 8, true);
+
+		// a steady frame rate against one that jumps about, neither should matter to a manually stepped domain
+		TArray<float> SteadyDeltas;
+		SteadyDeltas.Init(1.f / StepsPerSecond, NumSteps);
+
+		FRandomStream Stream(1);
+		TArray<float> UnevenDeltas;
+
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			UnevenDeltas.Add(Stream.FRand() < 0.05f ? 0.25f : Stream.FRandRange(1.f / 144.f, 1.f / 20.f));
+		}
+
+		const FRun First = Run(*World, *Subsystem, SteadyDeltas);
+		const FRun Second = Run(*World, *Subsystem, UnevenDeltas);
+
+		int32 FirstMismatch = INDEX_NONE;
+
+		for (int32 Index = 0; Index < First.Values.Num() && FirstMismatch == INDEX_NONE; ++Index)
+		{
+			FirstMismatch = First.Values[Index] != Second.Values[Index] ? Index : INDEX_NONE;
+		}
+
+		if (FirstMismatch != INDEX_NONE)
+		{
+			AddError(FString::Printf(TEXT("Tween %d differs at step %d"), FirstMismatch % UE_ARRAY_COUNT(Setups), FirstMismatch / UE_ARRAY_COUNT(Setups) + 1));
+		}
+
+		TestEqual(TEXT("Values recorded"), First.Values.Num(), Second.Values.Num());
+		TestEqual(TEXT("Steps each tween completed on"), First.CompleteSteps, Second.CompleteSteps);
+		TestEqual(TEXT("Step a 0.1 s tween completes on at 60 steps a second"), First.CompleteSteps[0], LinearCompleteStep);
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif
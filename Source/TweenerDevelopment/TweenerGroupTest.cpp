@@ -0,0 +1,61 @@
+#include "Tween.h"
+#include "TweenerBenchmarkCommandlet.h"
+#include "TweenerSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenerGroupRunningTweenTest, "Tweener.Group.RunningTween",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTweenerGroupRunningTweenTest::RunTest(const FString& Parameters)
+{
+	const FName Group(TEXT("GroupTest"));
+	constexpr float FrameDeltaTime = 1.f / 60.f;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("TweenerGroupTest"));
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	UTweenerSubsystem* Subsystem = World->GetSubsystem<UTweenerSubsystem>();
+
+	if (TestNotNull(TEXT("Tweener subsystem"), Subsystem))
+	{
+		TStrongObjectPtr<UTweenerBenchmarkTarget> Target(NewObject<UTweenerBenchmarkTarget>(GetTransientPackage()));
+
+		UTween* Tween = Subsystem->StartTween(UTween::FloatTo(Target.Get(), GET_MEMBER_NAME_CHECKED(UTweenerBenchmarkTarget, Value), 10.f, false, 1.f,
+			EEaseType::Linear, ELoopType::None, 0, 0.f, World));
+
+		World->Tick(LEVELTICK_All, FrameDeltaTime);
+
+		// grouped the way the builders are normally chained, after the tween has started
+		Tween->AddToGroup(Group);
+
+		TestTrue(TEXT("Tween is running before the group is stopped"), Subsystem->IsTweenActive(Tween));
+		TestTrue(TEXT("Running tween is one of the group's tweens"), Subsystem->GetGroupTweens(Group).Contains(Tween));
+		TestEqual(TEXT("Tweens stopped with the group"), Subsystem->StopGroup(Group), 1);
+
+		const float StoppedValue = Target->Value;
+
+		World->Tick(LEVELTICK_All, FrameDeltaTime);
+
+		TestFalse(TEXT("Tween is running after the group is stopped"), Subsystem->IsTweenActive(Tween));
+		TestEqual(TEXT("Value after the group is stopped"), Target->Value, StoppedValue);
+
+		Subsystem->StopAllTweens(false);
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,290 @@
+#include "TweenerReplicationTest.h"
+
+#include "Tween.h"
+#include "TweenerSubsystem.h"
+#include "TweenReplicationComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#endif
+
+ATweenerReplicationTestActor::ATweenerReplicationTestActor()
+{
+	Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	RootComponent = Root;
+
+	TweenReplication = CreateDefaultSubobject<UTweenReplicationComponent>(TEXT("TweenReplication"));
+
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	SetReplicatingMovement(false);
+}
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+namespace TweenerReplicationTest
+{
+	constexpr float Duration = 2.f;
+
+	const FVector EndLocation(200.f, 0.f, 0.f);
+
+	/** Fastest the quadratic ease in out moves the target */
+	constexpr float MaxSpeed = 2.f * 200.f / Duration;
+
+	/** How far the client's estimate of the server clock may be out, the game state only syncs it every so often */
+	constexpr float MaxClockError = 0.1f;
+
+	/** Frames the client has to hold the server's transform after a correction */
+	constexpr int32 StableFrames = 30;
+
+	constexpr double StepTimeoutSeconds = 30.0;
+
+	UWorld* FindPlayWorld(ENetMode NetMode)
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+
+			if (Context.WorldType == EWorldType::PIE && World && World->GetNetMode() == NetMode)
+			{
+				return World;
+			}
+		}
+
+		return nullptr;
+	}
+
+	ATweenerReplicationTestActor* FindTestActor(UWorld* World)
+	{
+		TActorIterator<ATweenerReplicationTestActor> It(World);
+		return It ? *It : nullptr;
+	}
+
+	/**
+	 * Drives a listen server and a client in one PIE session. The server plays a tween to the end and the client
+	 * has to follow it from the descriptor alone, then the server stops a second tween halfway and the client has to
+	 * take its correction.
+	 */
+	class FLoopbackCommand : public IAutomationLatentCommand
+	{
+	public:
+
+		explicit FLoopbackCommand(FAutomationTestBase& InTest)
+			: Test(InTest)
+		{
+		}
+
+		virtual bool Update() override;
+
+	private:
+
+		enum class EStep : uint8
+		{
+			WaitForClient,
+			WaitForActor,
+			FollowTween,
+			StopTween,
+			WaitForCorrection
+		};
+
+		void NextStep(EStep InStep)
+		{
+			Step = InStep;
+			StepStartSeconds = FPlatformTime::Seconds();
+		}
+
+		bool Finish()
+		{
+			GEditor->RequestEndPlayMap();
+			return true;
+		}
+
+		bool Fail(const FString& Message)
+		{
+			Test.AddError(Message);
+			return Finish();
+		}
+
+		/** Started without a world context, so the tween can't find its world by itself */
+		UTween* StartServerTween(const FVector& Location);
+
+		FAutomationTestBase& Test;
+
+		EStep Step = EStep::WaitForClient;
+
+		double StepStartSeconds = FPlatformTime::Seconds();
+
+		TWeakObjectPtr<ATweenerReplicationTestActor> ServerActor;
+
+		TWeakObjectPtr<UTween> ServerTween;
+
+		int32 NumFollowedFrames = 0;
+
+		int32 NumStableFrames = 0;
+
+		FVector StopLocation = FVector::ZeroVector;
+	};
+
+	UTween* FLoopbackCommand::StartServerTween(const FVector& Location)
+	{
+		UTween* Tween = UTween::ComponentRelativeLocationTo(ServerActor->Root, Location, false, Duration, EEaseType::QuadraticEaseInOut);
+
+		return ServerActor->TweenReplication->StartReplicatedTween(Tween);
+	}
+
+	bool FLoopbackCommand::Update()
+	{
+		if (FPlatformTime::Seconds() - StepStartSeconds > StepTimeoutSeconds)
+		{
+			return Fail(FString::Printf(TEXT("Timed out in step %d"), static_cast<int32>(Step)));
+		}
+
+		UWorld* ServerWorld = FindPlayWorld(NM_ListenServer);
+		UWorld* ClientWorld = FindPlayWorld(NM_Client);
+
+		if (Step == EStep::WaitForClient)
+		{
+			// connected once the client has a player controller and a game state to take the server's clock from
+			if (!ServerWorld || !ClientWorld || !ClientWorld->GetFirstPlayerController() || !ClientWorld->GetGameState())
+			{
+				return false;
+			}
+
+			ServerActor = ServerWorld->SpawnActor<ATweenerReplicationTestActor>(FVector::ZeroVector, FRotator::ZeroRotator);
+			NextStep(EStep::WaitForActor);
+			return false;
+		}
+
+		if (!ServerWorld || !ClientWorld || !ServerActor.IsValid())
+		{
+			return Fail(TEXT("The play session ended early"));
+		}
+
+		UTweenerSubsystem* ServerSubsystem = ServerWorld->GetSubsystem<UTweenerSubsystem>();
+		ATweenerReplicationTestActor* ClientActor = FindTestActor(ClientWorld);
+
+		const FVector ServerLocation = ServerActor->Root->GetRelativeLocation();
+		const FVector ClientLocation = ClientActor ? ClientActor->Root->GetRelativeLocation() : FVector::ZeroVector;
+
+		switch (Step)
+		{
+			case EStep::WaitForActor:
+				if (!ClientActor)
+				{
+					return false;
+				}
+
+				ServerTween = StartServerTween(EndLocation);
+
+				if (!ServerTween.IsValid())
+				{
+					return Fail(TEXT("StartReplicatedTween refused the tween"));
+				}
+
+				NextStep(EStep::FollowTween);
+				return false;
+
+			case EStep::FollowTween:
+				{
+					const bool bIsServerTweenActive = ServerSubsystem->IsTweenActive(ServerTween.Get());
+
+					// the descriptor is still on its way
+					if (ClientLocation.IsZero() && bIsServerTweenActive)
+					{
+						return false;
+					}
+
+					if (!ClientLocation.Equals(ServerLocation, MaxSpeed * MaxClockError))
+					{
+						return Fail(FString::Printf(TEXT("Client at %s while the server is at %s"), *ClientLocation.ToString(), *ServerLocation.ToString()));
+					}
+
+					++NumFollowedFrames;
+
+					if (bIsServerTweenActive || !ClientLocation.Equals(EndLocation, KINDA_SMALL_NUMBER))
+					{
+						return false;
+					}
+
+					if (NumFollowedFrames < 10)
+					{
+						return Fail(FString::Printf(TEXT("Only %d frames of the tween reached the client"), NumFollowedFrames));
+					}
+
+					ServerTween = StartServerTween(FVector::ZeroVector);
+
+					if (!ServerTween.IsValid())
+					{
+						return Fail(TEXT("StartReplicatedTween refused the second tween"));
+					}
+
+					NextStep(EStep::StopTween);
+					return false;
+				}
+
+			case EStep::StopTween:
+				if (!ServerTween.IsValid())
+				{
+					return Fail(TEXT("The second tween was collected"));
+				}
+
+				if (ServerTween->ElapsedTime < Duration * 0.5f)
+				{
+					return false;
+				}
+
+				ServerSubsystem->StopTween(ServerTween.Get());
+				StopLocation = ServerLocation;
+
+				NextStep(EStep::WaitForCorrection);
+				return false;
+
+			case EStep::WaitForCorrection:
+				// the client would otherwise carry on back to the start
+				NumStableFrames = ClientLocation.Equals(StopLocation, KINDA_SMALL_NUMBER) ? NumStableFrames + 1 : 0;
+
+				return NumStableFrames >= StableFrames ? Finish() : false;
+
+			default:
+				return Fail(TEXT("Unknown step"));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTweenerReplicationLoopbackTest, "Tweener.Replication.Loopback",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FTweenerReplicationLoopbackTest::RunTest(const FString& Parameters)
+{
+	if (!GEditor || GEditor->IsPlaySessionInProgress())
+	{
+		AddError(TEXT("Needs the editor with no play session running"));
+		return false;
+	}
+
+	ULevelEditorPlaySettings* PlaySettings = NewObject<ULevelEditorPlaySettings>();
+	PlaySettings->SetPlayNetMode(EPlayNetMode::PIE_ListenServer);
+	PlaySettings->SetPlayNumberOfClients(2);
+	PlaySettings->bLaunchSeparateServer = false;
+	PlaySettings->SetRunUnderOneProcess(true);
+
+	FRequestPlaySessionParams Params;
+	Params.WorldType = EPlaySessionWorldType::PlayInEditor;
+	Params.EditorPlaySettings = PlaySettings;
+
+	GEditor->RequestPlaySession(Params);
+
+	ADD_LATENT_AUTOMATION_COMMAND(TweenerReplicationTest::FLoopbackCommand(*this));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "TweenerReplicationTest.generated.h"
+
+class USceneComponent;
+class UTweenReplicationComponent;
+
+/**
+ * Replicated actor for the Tweener.Replication.Loopback automation test. Its movement isn't replicated, so the only
+ * way the client's copy moves is by playing the tween descriptors it receives.
+ *
+ * UnrealEditor TweenerDevelopment.uproject -ExecCmds="Automation RunTests Tweener.Replication; Quit" -unattended -nullrhi
+ */
+UCLASS(NotPlaceable)
+class ATweenerReplicationTestActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+
+	ATweenerReplicationTestActor();
+
+	UPROPERTY()
+	USceneComponent* Root;
+
+	UPROPERTY()
+	UTweenReplicationComponent* TweenReplication;
+};